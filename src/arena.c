@@ -0,0 +1,59 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: arena.c
+ * Per frame memory arena for transient buffers
+ */
+
+#include "arena.h"
+#include "config.h"
+
+/* Arena memory block. Declared in words to keep it aligned */
+static uint16_t arena_buffer[(ARENA_SIZE + 1) >> 1];
+/* Allocated bytes and peak allocated bytes since arena_init */
+static uint16_t arena_top;
+static uint16_t arena_top_max;
+
+void arena_init(void)
+{
+    arena_top = 0;
+    arena_top_max = 0;
+}
+
+void *arena_alloc(const uint16_t size)
+{
+    void *buffer;
+    /* Size rounded up to keep buffers word aligned, 0xFFFF must not wrap */
+    uint32_t aligned_size = ((uint32_t) size + 1) & ~1;
+
+    if (aligned_size > (uint32_t) (ARENA_SIZE - arena_top))
+    {
+        return 0;
+    }
+
+    buffer = ((uint8_t *) arena_buffer) + arena_top;
+    arena_top += aligned_size;
+    if (arena_top > arena_top_max)
+    {
+        arena_top_max = arena_top;
+    }
+    return buffer;
+}
+
+inline void arena_reset(void)
+{
+    arena_top = 0;
+}
+
+inline uint16_t arena_used(void)
+{
+    return arena_top;
+}
+
+inline uint16_t arena_high_water(void)
+{
+    return arena_top_max;
+}
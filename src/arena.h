@@ -0,0 +1,68 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: arena.h
+ * Per frame memory arena for transient buffers
+ *
+ * The arena is a small block of work RAM where short lived buffers can be
+ * allocated just moving a pointer. There is no free operation, the whole arena
+ * is reset after each DMA queue flush (see dma_queue_flush). This way, buffers
+ * used as source of deferred DMA transfers are guaranteed to be valid until the
+ * DMA operations are executed.
+ * A high-water mark keeps the maximum amount of memory used in a frame, so the
+ * arena size (ARENA_SIZE in config.h) can be tuned.
+ * 
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdint.h>
+
+/**
+ * @brief Initialises the arena
+ * 
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void arena_init(void);
+
+/**
+ * @brief Allocates a buffer in the arena
+ * 
+ * Buffers are word aligned and live until the next arena reset.
+ * 
+ * @param size Buffer size in bytes
+ * @return void* Allocated buffer or NULL if there is not enough space
+ */
+void *arena_alloc(const uint16_t size);
+
+/**
+ * @brief Frees all the buffers allocated in the arena
+ * 
+ * @note This function is called automatically by dma_queue_flush, so you
+ * don't need to call it.
+ */
+void arena_reset(void);
+
+/**
+ * @brief Gets the amount of memory currently allocated in the arena
+ * 
+ * @return uint16_t Allocated bytes
+ */
+uint16_t arena_used(void);
+
+/**
+ * @brief Gets the peak amount of memory allocated in the arena
+ * 
+ * The peak is kept since arena_init and it is not cleared by arena_reset, so
+ * it is the biggest frame seen so far. Use it to tune ARENA_SIZE.
+ * 
+ * @return uint16_t High-water mark in bytes since arena_init
+ */
+uint16_t arena_high_water(void);
+
+#endif /* ARENA_H */
@@ -16,8 +16,46 @@
  _int_external:
     rte
 
+/**
+ * @brief Handler for the horizontal blank interrupt
+ * 
+ * Runs the group of raster operations scheduled for the current scanline (see
+ * raster.c). It must be as short as possible to fit in the hblank window.
+ * The group starts with the HBlank counter write for the next gap followed by
+ * the operations, each one with its operation code:
+ *      0: End of group
+ *      1: Word written to the control port
+ *      2: Long written to the control port and word written to the data port
+ *      3: Long address of a callback
+ */
 .global _int_hblank
  _int_hblank:
+    movem.l d0-d1/a0-a1, -(sp)      /* Callbacks may use these registers */
+    move.l  (raster_cursor), a0     /* Current group of operations */
+    lea     0xC00004, a1            /* VDP control port */
+    move.w  (a0)+, (a1)             /* Reprograms the HBlank counter */
+hblank_op_next:
+    move.w  (a0)+, d0               /* Operation code */
+    beq.s   hblank_end
+    subq.w  #2, d0
+    bmi.s   hblank_op_ctrl          /* Code 1 */
+    beq.s   hblank_op_data          /* Code 2 */
+    move.l  (a0)+, a1               /* Code 3, callback address */
+    move.l  a0, (raster_cursor)     /* Save the cursor, a0 may be clobbered */
+    jsr     (a1)
+    move.l  (raster_cursor), a0
+    lea     0xC00004, a1
+    bra.s   hblank_op_next
+hblank_op_ctrl:
+    move.w  (a0)+, (a1)             /* Register write */
+    bra.s   hblank_op_next
+hblank_op_data:
+    move.l  (a0)+, (a1)             /* Write address command */
+    move.w  (a0)+, -4(a1)           /* Data port */
+    bra.s   hblank_op_next
+hblank_end:
+    move.l  a0, (raster_cursor)     /* Next group of operations */
+    movem.l (sp)+, d0-d1/a0-a1
     rte
 
 /**
@@ -28,14 +66,22 @@
  */
 .global _int_vblank
  _int_vblank:
+    movem.l d0-d1/a0-a1, -(sp)      /* Scratch registers used by C code */
 
     /* Here should be whatever you wanted to do in the vinterrupt */
 
+    /* Raster effects for the next frame */
+    bsr raster_update
+
+    /* PSG sfx, written to the PSG by sound_update */
+    bsr psg_sfx_update
+
     /* XGM synchronisation proccess */
     bsr sound_update
 
     /* Set the vblak flag to 1 to indicate that the interrupt is finished  */
     st.b    (vid_vblank_flag)
+    movem.l (sp)+, d0-d1/a0-a1
     rte
 
 .global _int_unhandled
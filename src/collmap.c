@@ -0,0 +1,209 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: collmap.c
+ * Tile based collision maps
+ */
+
+#include "collmap.h"
+
+/* Current collision map */
+static const uint8_t *collmap_data;
+static uint16_t collmap_width;
+static uint16_t collmap_height;
+static uint16_t collmap_pitch;
+static uint8_t collmap_bits;
+
+/* Value returned outside the map */
+static uint8_t collmap_border = COLLMAP_SOLID;
+
+void collmap_set(const uint8_t *data, const uint16_t width,
+                 const uint16_t height, const uint8_t bits)
+{
+    collmap_data = data;
+    collmap_width = width;
+    collmap_height = height;
+    collmap_bits = bits;
+    /* Rows are padded to whole bytes */
+    collmap_pitch = ((width * bits) + 7) >> 3;
+}
+
+inline void collmap_border_set(const uint8_t value)
+{
+    collmap_border = value;
+}
+
+uint8_t collmap_tile_get(const int16_t x, const int16_t y)
+{
+    const uint8_t *row;
+
+    /* Negative values become huge when unsigned, one check is enough */
+    if ((uint16_t) x >= collmap_width || (uint16_t) y >= collmap_height)
+    {
+        return collmap_border;
+    }
+
+    row = collmap_data + (uint16_t) y * collmap_pitch;
+    if (collmap_bits == 2)
+    {
+        /* Four tiles per byte, the first one in bits 7-6 */
+        return (row[x >> 2] >> ((~x & 3) << 1)) & 0x03;
+    }
+    /* Two tiles per byte, the first one in the high nibble */
+    return (x & 1) ? row[x >> 1] & 0x0F : row[x >> 1] >> 4;
+}
+
+inline uint8_t collmap_point_get(const int16_t x, const int16_t y)
+{
+    return collmap_tile_get(x >> 3, y >> 3);
+}
+
+/**
+ * @brief Checks a column of tiles against a mask
+ *
+ * @param x Tile column
+ * @param y0 First tile row
+ * @param y1 Last tile row
+ * @param mask Collision values to check
+ * @return true if any tile matches the mask
+ */
+static bool collmap_column_test(const int16_t x, int16_t y0, const int16_t y1,
+                                const uint16_t mask)
+{
+    for (; y0 <= y1; ++y0)
+    {
+        if (COLLMAP_MASK(collmap_tile_get(x, y0)) & mask)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Checks a row of tiles against a mask
+ *
+ * @param y Tile row
+ * @param x0 First tile column
+ * @param x1 Last tile column
+ * @param mask Collision values to check
+ * @return true if any tile matches the mask
+ */
+static bool collmap_row_test(const int16_t y, int16_t x0, const int16_t x1,
+                             const uint16_t mask)
+{
+    for (; x0 <= x1; ++x0)
+    {
+        if (COLLMAP_MASK(collmap_tile_get(x0, y)) & mask)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool collmap_box_test(const int16_t x, const int16_t y, const uint16_t width,
+                      const uint16_t height, const uint16_t mask)
+{
+    int16_t row;
+    int16_t row_last;
+
+    row_last = (y + height - 1) >> 3;
+    for (row = y >> 3; row <= row_last; ++row)
+    {
+        if (collmap_row_test(row, x >> 3, (x + width - 1) >> 3, mask))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int16_t collmap_sweep_x(const int16_t x, const int16_t y, const uint16_t width,
+                        const uint16_t height, const int16_t dx,
+                        const uint16_t mask)
+{
+    int16_t col;
+    int16_t col_last;
+    int16_t row0;
+    int16_t row1;
+    uint16_t block_mask;
+
+    block_mask = mask & ~COLLMAP_MASK(COLLMAP_PLATFORM);
+    row0 = y >> 3;
+    row1 = (y + height - 1) >> 3;
+
+    if (dx > 0)
+    {
+        /* Columns crossed by the right edge */
+        col_last = (x + width - 1 + dx) >> 3;
+        for (col = ((x + width - 1) >> 3) + 1; col <= col_last; ++col)
+        {
+            if (collmap_column_test(col, row0, row1, block_mask))
+            {
+                return (col << 3) - (x + width);
+            }
+        }
+    }
+    else if (dx < 0)
+    {
+        /* Columns crossed by the left edge */
+        col_last = (x + dx) >> 3;
+        for (col = (x >> 3) - 1; col >= col_last; --col)
+        {
+            if (collmap_column_test(col, row0, row1, block_mask))
+            {
+                return ((col + 1) << 3) - x;
+            }
+        }
+    }
+
+    return dx;
+}
+
+int16_t collmap_sweep_y(const int16_t x, const int16_t y, const uint16_t width,
+                        const uint16_t height, const int16_t dy,
+                        const uint16_t mask)
+{
+    int16_t row;
+    int16_t row_last;
+    int16_t col0;
+    int16_t col1;
+
+    col0 = x >> 3;
+    col1 = (x + width - 1) >> 3;
+
+    if (dy > 0)
+    {
+        /*
+         * Rows crossed by the bottom edge. They are all below the box, so the
+         * platforms are landed on from above
+         */
+        row_last = (y + height - 1 + dy) >> 3;
+        for (row = ((y + height - 1) >> 3) + 1; row <= row_last; ++row)
+        {
+            if (collmap_row_test(row, col0, col1, mask))
+            {
+                return (row << 3) - (y + height);
+            }
+        }
+    }
+    else if (dy < 0)
+    {
+        /* Rows crossed by the top edge, platforms can be crossed from below */
+        row_last = (y + dy) >> 3;
+        for (row = (y >> 3) - 1; row >= row_last; --row)
+        {
+            if (collmap_row_test(row, col0, col1,
+                                 mask & ~COLLMAP_MASK(COLLMAP_PLATFORM)))
+            {
+                return ((row + 1) << 3) - y;
+            }
+        }
+    }
+
+    return dy;
+}
@@ -0,0 +1,135 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: collmap.h
+ * Tile based collision maps
+ *
+ * A collision map stores a collision value for each 8x8 pixels tile of a level
+ * packed in 2 or 4 bits per tile (first tile in the high bits of each byte,
+ * rows padded to whole bytes). Maps are built from indexed png files with the
+ * collmaptool tool, where each pixel is a tile and its color index is the
+ * collision value.
+ * Values 0..3 are empty, solid, platform and hazard tiles. 4 bits maps can use
+ * values 4..15 as slope indexes which meaning is up to the game.
+ * Queries work directly on the packed data, so a 1024x256 tiles level only
+ * needs 64 KB of ROM using 2 bits per tile.
+ * Most queries receive a mask with the collision values to check, built with
+ * COLLMAP_MASK (i.e. COLLMAP_MASK(COLLMAP_SOLID) | COLLMAP_MASK(COLLMAP_HAZARD)).
+ */
+
+#ifndef COLLMAP_H
+#define COLLMAP_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Collision values */
+#define COLLMAP_EMPTY       0x00
+#define COLLMAP_SOLID       0x01
+#define COLLMAP_PLATFORM    0x02
+#define COLLMAP_HAZARD      0x03
+#define COLLMAP_SLOPE_FIRST 0x04
+
+/* Builds a mask of collision values to use in the queries */
+#define COLLMAP_MASK(value) ((uint16_t) (1 << (value)))
+
+/* Mask for the tiles which stop movement */
+#define COLLMAP_MASK_BLOCK  (COLLMAP_MASK(COLLMAP_SOLID) | \
+                             COLLMAP_MASK(COLLMAP_PLATFORM))
+
+/**
+ * @brief Sets the current collision map
+ *
+ * @param data Packed collision map data
+ * @param width Map width in tiles
+ * @param height Map height in tiles
+ * @param bits Bits per tile, 2 or 4
+ *
+ * @note The tool generates defines for width, height and bits for each map
+ */
+void collmap_set(const uint8_t *data, const uint16_t width,
+                 const uint16_t height, const uint8_t bits);
+
+/**
+ * @brief Sets the collision value returned outside the map limits
+ *
+ * @param value Collision value, COLLMAP_SOLID by default
+ */
+void collmap_border_set(const uint8_t value);
+
+/**
+ * @brief Gets the collision value of a tile
+ *
+ * @param x Tile horizontal position
+ * @param y Tile vertical position
+ * @return uint8_t Collision value, the border value if it is out of the map
+ */
+uint8_t collmap_tile_get(const int16_t x, const int16_t y);
+
+/**
+ * @brief Gets the collision value in a pixel position
+ *
+ * @param x Horizontal position in pixels
+ * @param y Vertical position in pixels
+ * @return uint8_t Collision value of the tile containing the pixel
+ */
+uint8_t collmap_point_get(const int16_t x, const int16_t y);
+
+/**
+ * @brief Checks if any tile under a box has one of the values in a mask
+ *
+ * @param x Box left position in pixels
+ * @param y Box top position in pixels
+ * @param width Box width in pixels, greater than 0
+ * @param height Box height in pixels, greater than 0
+ * @param mask Collision values to check (see COLLMAP_MASK)
+ * @return true if any tile under the box matches the mask, false otherwise
+ */
+bool collmap_box_test(const int16_t x, const int16_t y, const uint16_t width,
+                      const uint16_t height, const uint16_t mask);
+
+/**
+ * @brief Moves a box horizontally until it hits a tile
+ *
+ * Sweeps the box leading edge through the tiles it would cross and returns
+ * how far it can move before hitting a tile in the mask.
+ *
+ * @param x Box left position in pixels
+ * @param y Box top position in pixels
+ * @param width Box width in pixels, greater than 0
+ * @param height Box height in pixels, greater than 0
+ * @param dx Desired horizontal displacement in pixels
+ * @param mask Collision values which stop the box (see COLLMAP_MASK)
+ * @return int16_t Allowed horizontal displacement
+ *
+ * @note Platform tiles only stop vertical downward movement, so they are
+ * ignored here
+ */
+int16_t collmap_sweep_x(const int16_t x, const int16_t y, const uint16_t width,
+                        const uint16_t height, const int16_t dx,
+                        const uint16_t mask);
+
+/**
+ * @brief Moves a box vertically until it hits a tile
+ *
+ * Sweeps the box leading edge through the tiles it would cross and returns
+ * how far it can move before hitting a tile in the mask.
+ *
+ * @param x Box left position in pixels
+ * @param y Box top position in pixels
+ * @param width Box width in pixels, greater than 0
+ * @param height Box height in pixels, greater than 0
+ * @param dy Desired vertical displacement in pixels
+ * @param mask Collision values which stop the box (see COLLMAP_MASK)
+ * @return int16_t Allowed vertical displacement
+ *
+ * @note Platform tiles only stop the box when it moves down from above them
+ */
+int16_t collmap_sweep_y(const int16_t x, const int16_t y, const uint16_t width,
+                        const uint16_t height, const int16_t dy,
+                        const uint16_t mask);
+
+#endif /* COLLMAP_H */
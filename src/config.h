@@ -57,4 +57,83 @@
 /* DMA internal queue size in operations */
 #define DMA_QUEUE_SIZE 64
 
+/* 
+ * Arena configuration default values
+ */
+/* Per frame arena size in bytes */
+#define ARENA_SIZE 4096
+
+/* 
+ * Palette configuration default values
+ */
+/* Maximum number of simultaneous palette color cycles */
+#define PAL_CYCLE_SIZE 8
+
+/* 
+ * Raster effects configuration default values
+ */
+/* Raster operations list size */
+#define RASTER_SIZE 32
+
+/* 
+ * Collision grid configuration default values
+ */
+/* Grid cell size as a power of two (32x32 pixels cells) */
+#define GRID_CELL_SHIFT 5
+/* Grid size in cells, it covers the screen area (320x256 pixels) */
+#define GRID_COLS 10
+#define GRID_ROWS 8
+/* Maximum number of objects added to the grid each frame (256 at most) */
+#define GRID_OBJECTS 128
+/* Maximum number of object references stored in the grid cells */
+#define GRID_ENTRIES 384
+/* Maximum number of candidate pairs found each frame */
+#define GRID_PAIRS 256
+
+/* 
+ * Entity system configuration default values
+ */
+/* Maximum number of live entities */
+#define ENTITY_MAX 128
+
+/* 
+ * Task scheduler configuration default values
+ */
+/* Maximum number of simultaneous tasks */
+#define TASK_MAX 4
+/*
+ * Stack size of each task in bytes (must be even). It includes about 256 bytes
+ * used by the interrupt handlers when they are raised while a task runs
+ */
+#define TASK_STACK_SIZE 1024
+
+/* 
+ * Streaming decompression configuration default values
+ */
+/* Decompression window in bytes, two halves sent by DMA when they are full */
+#define STREAM_WINDOW 2048
+
+/* 
+ * PSG sfx configuration default values
+ */
+/* Channels the PSG sfx can use (bit n = channel n): tone 2 and noise, the
+ * songs must not use them */
+#define PSG_SFX_CHANNELS 0x0C
+
+/* 
+ * Sound synchronisation configuration default values
+ */
+/*
+ * Set to 1 to measure the busy wait the old synchronisation did: a deferred
+ * frame waits for the z80 and times it with the HV counter. Leave it to 0 in
+ * release builds, the wait is what the deferral saves
+ */
+#define SOUND_SYNC_MEASURE 0
+
+/* 
+ * ROM mapper configuration default values
+ */
+/* First of the two slots used to map far data (slots 6 and 7: 0x300000) */
+#define MAPPER_WINDOW_SLOT 6
+
 #endif /* MEGADRIVE_CONFIG_H */
@@ -12,6 +12,7 @@
 #include "config.h"
 #include "vdp.h"
 #include "z80.h"
+#include "arena.h"
 
 /* Defines a DMA queue command operation */
 typedef struct dma_command
@@ -83,6 +84,7 @@ bool dma_transfer_fast(const uint32_t src, const uint16_t dest,
     /* Issues the DMA from a ram varible and in words (see SEGA notes on DMA) */ 
     *VDP_PORT_CTRL_W = *cmd_p;
     ++cmd_p;
+    z80_prof_site_set(Z80_PROF_DMA);
     z80_bus_request_fast();
     *VDP_PORT_CTRL_W = *cmd_p;
     z80_bus_release();
@@ -342,6 +344,7 @@ void dma_queue_flush(void)
     uint32_t *queue_p = (uint32_t *) dma_queue;
     uint16_t i;
 
+    z80_prof_site_set(Z80_PROF_DMA);
     z80_bus_request_fast();
     for (i = 0; i < dma_queue_index; ++i)
     {
@@ -363,6 +366,8 @@ void dma_queue_flush(void)
     }
     z80_bus_release();
     dma_queue_clear();
+    /* Transfers are done, so their arena source buffers are not needed */
+    arena_reset();
 }
 
 bool dma_queue_vram_transfer(const void *restrict src, const uint16_t dest,
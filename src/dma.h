@@ -151,6 +151,8 @@ void dma_queue_clear(void);
 /**
  * @brief Executes all the pending DMA's commands in the queue and resets it
  * 
+ * Once the commands are executed, the per frame arena is reset too (see
+ * arena.h), so its buffers can be used as source of queued transfers.
  */
 void dma_queue_flush(void);
 
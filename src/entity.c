@@ -0,0 +1,222 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: entity.c
+ * Structure of arrays entity system
+ */
+
+#include "entity.h"
+#include "sprite.h"
+
+/* Entity properties */
+fix16_t entity_x[ENTITY_MAX];
+fix16_t entity_y[ENTITY_MAX];
+fix16_t entity_vx[ENTITY_MAX];
+fix16_t entity_vy[ENTITY_MAX];
+uint16_t entity_attr[ENTITY_MAX];
+uint8_t entity_size[ENTITY_MAX];
+uint8_t entity_flags[ENTITY_MAX];
+uint8_t entity_state[ENTITY_MAX];
+
+/* Number of live entities */
+static uint16_t entity_count;
+/* Visible entities found in the last culling pass */
+static uint16_t entity_visible_count;
+
+void entity_init(void)
+{
+    entity_clear();
+}
+
+inline void entity_clear(void)
+{
+    entity_count = 0;
+    entity_visible_count = 0;
+}
+
+inline uint16_t entity_count_get(void)
+{
+    return entity_count;
+}
+
+int16_t entity_create(const fix16_t x, const fix16_t y, const fix16_t vx,
+                      const fix16_t vy, const uint16_t attr, const uint8_t size)
+{
+    uint16_t index;
+
+    if (entity_count >= ENTITY_MAX)
+    {
+        return -1;
+    }
+
+    index = entity_count;
+    entity_x[index] = x;
+    entity_y[index] = y;
+    entity_vx[index] = vx;
+    entity_vy[index] = vy;
+    entity_attr[index] = attr;
+    entity_size[index] = size;
+    entity_flags[index] = 0;
+    entity_state[index] = 0;
+    ++entity_count;
+
+    return index;
+}
+
+void entity_destroy(const uint16_t index)
+{
+    uint16_t last;
+
+    if (index >= entity_count)
+    {
+        return;
+    }
+
+    /* Keep the arrays dense moving the last entity to the hole */
+    --entity_count;
+    last = entity_count;
+    if (index != last)
+    {
+        entity_x[index] = entity_x[last];
+        entity_y[index] = entity_y[last];
+        entity_vx[index] = entity_vx[last];
+        entity_vy[index] = entity_vy[last];
+        entity_attr[index] = entity_attr[last];
+        entity_size[index] = entity_size[last];
+        entity_flags[index] = entity_flags[last];
+        entity_state[index] = entity_state[last];
+    }
+}
+
+void entity_integrate(void)
+{
+    fix16_t *x;
+    fix16_t *vx;
+    uint16_t i;
+
+    /* One array pair per loop, so the pointers stay in address registers */
+    x = entity_x;
+    vx = entity_vx;
+    for (i = entity_count; i; --i)
+    {
+        *x++ += *vx++;
+    }
+
+    x = entity_y;
+    vx = entity_vy;
+    for (i = entity_count; i; --i)
+    {
+        *x++ += *vx++;
+    }
+}
+
+uint16_t entity_cull(const int16_t camera_x, const int16_t camera_y)
+{
+    const fix16_t *x;
+    const fix16_t *y;
+    const uint8_t *size;
+    uint8_t *flags;
+    int16_t screen_x;
+    int16_t screen_y;
+    uint16_t visible;
+    uint16_t i;
+
+    x = entity_x;
+    y = entity_y;
+    size = entity_size;
+    flags = entity_flags;
+    visible = 0;
+    for (i = entity_count; i; --i)
+    {
+        screen_x = FIX16_TO_INT(*x++) - camera_x;
+        screen_y = FIX16_TO_INT(*y++) - camera_y;
+
+        /* Sprite box against the screen box */
+        if (screen_x > -SPRITE_WIDTH(*size) &&
+            screen_x < ENTITY_SCREEN_WIDTH &&
+            screen_y > -SPRITE_HEIGHT(*size) &&
+            screen_y < ENTITY_SCREEN_HEIGHT &&
+            !(*flags & ENTITY_FLAG_HIDDEN))
+        {
+            *flags |= ENTITY_FLAG_VISIBLE;
+            ++visible;
+        }
+        else
+        {
+            *flags &= ~ENTITY_FLAG_VISIBLE;
+        }
+        ++size;
+        ++flags;
+    }
+    entity_visible_count = visible;
+
+    return visible;
+}
+
+uint16_t entity_sprites_emit(const int16_t camera_x, const int16_t camera_y)
+{
+    const fix16_t *x;
+    const fix16_t *y;
+    const uint16_t *attr;
+    const uint8_t *size;
+    const uint8_t *flags;
+    sprite_t *sprite;
+    uint16_t count;
+    uint16_t left;
+    uint16_t i;
+    int16_t offset_x;
+    int16_t offset_y;
+
+    /* Reserve all the needed entries at once, drop what doesn't fit */
+    count = entity_visible_count;
+    if (count > SPRITE_MAX - sprite_count_get())
+    {
+        count = SPRITE_MAX - sprite_count_get();
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+    sprite = sprite_alloc(count);
+
+    /* The VDP sprite coordinates start at 128 */
+    offset_x = 128 - camera_x;
+    offset_y = 128 - camera_y;
+
+    x = entity_x;
+    y = entity_y;
+    attr = entity_attr;
+    size = entity_size;
+    flags = entity_flags;
+    left = count;
+    for (i = entity_count; i && left; --i)
+    {
+        if (*flags & ENTITY_FLAG_VISIBLE)
+        {
+            sprite->y = FIX16_TO_INT(*y) + offset_y;
+            sprite->size = *size;
+            sprite->attr = *attr;
+            sprite->x = FIX16_TO_INT(*x) + offset_x;
+            ++sprite;
+            --left;
+        }
+        ++x;
+        ++y;
+        ++attr;
+        ++size;
+        ++flags;
+    }
+
+    /* Entities destroyed after culling leave reserved entries, hide them */
+    for (i = left; i; --i)
+    {
+        sprite->y = 0;
+        sprite->x = 0;
+        ++sprite;
+    }
+
+    return count - left;
+}
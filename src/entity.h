@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: entity.h
+ * Structure of arrays entity system
+ *
+ * Entities store their properties in parallel arrays instead of an array of
+ * structs, so batched passes walk each array with a simple pointer increment
+ * and the m68k doesn't waste time calculating field addresses.
+ * Live entities are kept dense at the start of the arrays: entities
+ * 0..entity_count_get() - 1 are alive. Destroying an entity moves the last
+ * one to its place, so entity indexes are not stable (iterate backwards when
+ * destroying entities inside a loop).
+ * Arrays are public so game code can read and write entity properties
+ * directly.
+ *
+ * A typical frame:
+ *  entity_integrate();
+ *  entity_cull(camera_x, camera_y);
+ *  sprite_clear();
+ *  entity_sprites_emit(camera_x, camera_y);
+ *  sprite_update();
+ */
+
+#ifndef ENTITY_H
+#define ENTITY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "config.h"
+#include "fix.h"
+
+/* Entity flags */
+#define ENTITY_FLAG_VISIBLE 0x01    /* Set by entity_cull if it is on screen */
+#define ENTITY_FLAG_HIDDEN  0x02    /* Never emit a sprite for this entity */
+
+/* Screen size used by the culling pass in pixels */
+#define ENTITY_SCREEN_WIDTH     320
+#define ENTITY_SCREEN_HEIGHT    224
+
+/* Entity properties, valid from 0 to entity_count_get() - 1 */
+extern fix16_t entity_x[ENTITY_MAX];        /* World horizontal position */
+extern fix16_t entity_y[ENTITY_MAX];        /* World vertical position */
+extern fix16_t entity_vx[ENTITY_MAX];       /* Horizontal speed per frame */
+extern fix16_t entity_vy[ENTITY_MAX];       /* Vertical speed per frame */
+extern uint16_t entity_attr[ENTITY_MAX];    /* Sprite attributes */
+extern uint8_t entity_size[ENTITY_MAX];     /* Sprite size (SPRITE_SIZE) */
+extern uint8_t entity_flags[ENTITY_MAX];    /* ENTITY_FLAG_* values */
+extern uint8_t entity_state[ENTITY_MAX];    /* Free for game logic */
+
+/**
+ * @brief Initialises the entity system
+ *
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void entity_init(void);
+
+/**
+ * @brief Destroys all the entities
+ */
+void entity_clear(void);
+
+/**
+ * @brief Gets the number of live entities
+ *
+ * @return uint16_t Live entities
+ */
+uint16_t entity_count_get(void);
+
+/**
+ * @brief Creates a new entity
+ *
+ * @param x World horizontal position
+ * @param y World vertical position
+ * @param vx Horizontal speed per frame
+ * @param vy Vertical speed per frame
+ * @param attr Sprite attributes (see sprite_attr_config)
+ * @param size Sprite size (see SPRITE_SIZE)
+ * @return int16_t Index of the new entity or -1 if there is no space
+ *
+ * @note The entity state is set to 0
+ */
+int16_t entity_create(const fix16_t x, const fix16_t y, const fix16_t vx,
+                      const fix16_t vy, const uint16_t attr, const uint8_t size);
+
+/**
+ * @brief Destroys an entity
+ *
+ * The last entity is moved to the destroyed entity index.
+ *
+ * @param index Index of the entity to destroy
+ */
+void entity_destroy(const uint16_t index);
+
+/**
+ * @brief Adds the speed to the position of all the entities
+ */
+void entity_integrate(void);
+
+/**
+ * @brief Updates the visible flag of all the entities
+ *
+ * An entity is visible if its sprite overlaps the screen area starting at the
+ * camera position.
+ *
+ * @param camera_x Camera horizontal position in world pixels
+ * @param camera_y Camera vertical position in world pixels
+ * @return uint16_t Number of visible entities
+ */
+uint16_t entity_cull(const int16_t camera_x, const int16_t camera_y);
+
+/**
+ * @brief Adds the sprites of the visible entities to the sprite table
+ *
+ * @param camera_x Camera horizontal position in world pixels
+ * @param camera_y Camera vertical position in world pixels
+ * @return uint16_t Number of sprites added
+ *
+ * @note It uses the visible flags from the last entity_cull call. Sprites not
+ * fitting in the sprite table are dropped.
+ */
+uint16_t entity_sprites_emit(const int16_t camera_x, const int16_t camera_y);
+
+#endif /* ENTITY_H */
@@ -0,0 +1,203 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: fix.c
+ * Fixed point math routines
+ */
+
+#include <stdbool.h>
+#include "fix.h"
+#include "fix_tables.h"
+
+inline fix8_t fix8_mul(const fix8_t a, const fix8_t b)
+{
+    return (fix8_t) (((int32_t) a * b) >> 8);
+}
+
+inline fix8_t fix8_div(const fix8_t a, const fix8_t b)
+{
+    int32_t result;
+
+    result = (int32_t) a << 8;
+#ifdef __m68k__
+    /* Force a 32/16 DIVS instead of the 32/32 libgcc division routine */
+    __asm__ ("\tdivs.w %1, %0\n" : "+d" (result) : "d" (b) : "cc");
+#else
+    /* Host builds (src/tests/host) */
+    result /= b;
+#endif
+
+    return (fix8_t) result;
+}
+
+fix16_t fix16_mul(const fix16_t a, const fix16_t b)
+{
+    uint32_t ua;
+    uint32_t ub;
+    uint32_t result;
+    bool negative;
+
+    /* Work with absolute values, partial products must be unsigned */
+    negative = (a ^ b) < 0;
+    ua = (a < 0) ? -a : a;
+    ub = (b < 0) ? -b : b;
+
+    /* (ah:al * bh:bl) >> 16 using four 16x16 bits MULU */
+    result = ((uint32_t) (uint16_t) (ua >> 16) * (uint16_t) (ub >> 16)) << 16;
+    result += (uint32_t) (uint16_t) (ua >> 16) * (uint16_t) ub;
+    result += (uint32_t) (uint16_t) ua * (uint16_t) (ub >> 16);
+    result += ((uint32_t) (uint16_t) ua * (uint16_t) ub) >> 16;
+
+    return negative ? -(fix16_t) result : (fix16_t) result;
+}
+
+fix16_t fix16_mul_fix8(const fix16_t a, const fix8_t b)
+{
+    uint32_t ua;
+    uint16_t ub;
+    uint32_t result;
+    bool negative;
+
+    negative = (a < 0) != (b < 0);
+    ua = (a < 0) ? -a : a;
+    ub = (b < 0) ? -b : b;
+
+    /* (ah:al * b) >> 8 using two 16x16 bits MULU */
+    result = ((uint32_t) (uint16_t) (ua >> 16) * ub) << 8;
+    result += ((uint32_t) (uint16_t) ua * ub) >> 8;
+
+    return negative ? -(fix16_t) result : (fix16_t) result;
+}
+
+fix16_t fix16_div_int(const fix16_t a, const uint8_t n)
+{
+    uint32_t ua;
+    uint32_t recip;
+    uint32_t middle;
+    uint32_t result;
+    uint16_t ua_high;
+    uint16_t ua_low;
+    uint16_t recip_high;
+    uint16_t recip_low;
+
+    /* The reciprocal of 1 doesn't fit in the table */
+    if (n == 1)
+    {
+        return a;
+    }
+
+    ua = (a < 0) ? -a : a;
+    recip = fix_tables_recip[n];
+    ua_high = ua >> 16;
+    ua_low = ua;
+    recip_high = recip >> 16;
+    recip_low = recip;
+
+    /*
+     * (ua * recip) >> 32 using four 16x16 bits MULU. The middle partial
+     * products are added apart so their carries reach the high word
+     */
+    middle = ((uint32_t) ua_low * recip_low) >> 16;
+    middle += (uint16_t) ((uint32_t) ua_low * recip_high);
+    middle += (uint16_t) ((uint32_t) ua_high * recip_low);
+    result = (uint32_t) ua_high * recip_high;
+    result += ((uint32_t) ua_low * recip_high) >> 16;
+    result += ((uint32_t) ua_high * recip_low) >> 16;
+    result += middle >> 16;
+
+    return (a < 0) ? -(fix16_t) result : (fix16_t) result;
+}
+
+inline fix16_t fix16_sin(const fix_angle_t angle)
+{
+    /* Table values are 2.14 fixed point */
+    return (fix16_t) fix_tables_sin[angle & FIX_ANGLE_MASK] << 2;
+}
+
+inline fix16_t fix16_cos(const fix_angle_t angle)
+{
+    return (fix16_t) fix_tables_sin[(angle + FIX_ANGLE_90) & FIX_ANGLE_MASK] << 2;
+}
+
+inline fix8_t fix8_sin(const fix_angle_t angle)
+{
+    return (fix8_t) (fix_tables_sin[angle & FIX_ANGLE_MASK] >> 6);
+}
+
+inline fix8_t fix8_cos(const fix_angle_t angle)
+{
+    return (fix8_t) (fix_tables_sin[(angle + FIX_ANGLE_90) & FIX_ANGLE_MASK] >> 6);
+}
+
+fix_angle_t fix_atan2(const int32_t y, const int32_t x)
+{
+    uint32_t ax;
+    uint32_t ay;
+    uint32_t num;
+    uint32_t den;
+    uint16_t ratio;
+    fix_angle_t angle;
+
+    if (x == 0 && y == 0)
+    {
+        return 0;
+    }
+
+    ax = (x < 0) ? -x : x;
+    ay = (y < 0) ? -y : y;
+
+    /* Reduce to the first octant, the ratio must be in 0..1 */
+    if (ay <= ax)
+    {
+        num = ay;
+        den = ax;
+    }
+    else
+    {
+        num = ax;
+        den = ay;
+    }
+
+    /* Scale down until the denominator fits in the reciprocal table */
+    while (den > 255)
+    {
+        num >>= 1;
+        den >>= 1;
+    }
+
+    /* ratio = num * 256 / den, using the reciprocal table */
+    if (den == 1)
+    {
+        ratio = num << 8;
+    }
+    else
+    {
+        /* The 0.16 reciprocal is enough for the table index */
+        ratio = ((uint32_t) (uint16_t) num *
+                 (uint16_t) ((fix_tables_recip[den] + 0x8000) >> 16)) >> 8;
+        if (ratio > 256)
+        {
+            ratio = 256;
+        }
+    }
+    angle = fix_tables_atan[ratio];
+
+    /* Move the angle back to its octant and quadrant */
+    if (ay > ax)
+    {
+        angle = FIX_ANGLE_90 - angle;
+    }
+    if (x < 0)
+    {
+        angle = FIX_ANGLE_180 - angle;
+    }
+    if (y < 0)
+    {
+        angle = (FIX_ANGLE_STEPS - angle) & FIX_ANGLE_MASK;
+    }
+
+    return angle;
+}
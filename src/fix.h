@@ -0,0 +1,180 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: fix.h
+ * Fixed point math routines
+ *
+ * The m68000 has no FPU and its division instructions are really slow (DIVU
+ * takes around 140 cycles), so this module offers fixed point types and
+ * helpers which avoid divisions in the hot paths:
+ *  - fix16_t: signed 16.16 fixed point stored in 32 bits.
+ *  - fix8_t: signed 8.8 fixed point stored in 16 bits, multiplications use a
+ *    single MULS instruction.
+ *  - fix_angle_t: angles where a full turn is FIX_ANGLE_STEPS steps.
+ *
+ * Sine, cosine and arc tangent are solved with ROM lookup tables. Divisions by
+ * small integers use a 0.32 reciprocal table. These tables are generated by the
+ * fixtabletool host tool (see fix_tables.h and the fixtables make target).
+ */
+
+#ifndef FIX_H
+#define FIX_H
+
+#include <stdint.h>
+
+/* Fixed point types */
+typedef int32_t fix16_t;
+typedef int16_t fix8_t;
+typedef uint16_t fix_angle_t;
+
+/* Fixed point constants */
+#define FIX16_ONE       ((fix16_t) 0x00010000)
+#define FIX16_HALF      ((fix16_t) 0x00008000)
+#define FIX8_ONE        ((fix8_t) 0x0100)
+#define FIX8_HALF       ((fix8_t) 0x0080)
+
+/* Angles, a full turn has 1024 steps and angles grow counterclockwise */
+#define FIX_ANGLE_STEPS 1024
+#define FIX_ANGLE_MASK  (FIX_ANGLE_STEPS - 1)
+#define FIX_ANGLE_45    (FIX_ANGLE_STEPS / 8)
+#define FIX_ANGLE_90    (FIX_ANGLE_STEPS / 4)
+#define FIX_ANGLE_180   (FIX_ANGLE_STEPS / 2)
+#define FIX_ANGLE_270   (FIX_ANGLE_90 * 3)
+
+/**
+ * @brief Fixed point constants from literal values
+ *
+ * @note Only use them with constant values, so the floating point math is
+ * solved by the compiler
+ */
+#define FIX16(value)    ((fix16_t) ((value) * 65536.0))
+#define FIX8(value)     ((fix8_t) ((value) * 256.0))
+
+/* Conversions between integers and fixed point types */
+#define FIX16_FROM_INT(value)   ((fix16_t) (value) << 16)
+#define FIX16_TO_INT(value)     ((int16_t) ((value) >> 16))
+#define FIX16_FRAC(value)       ((value) & 0x0000FFFF)
+#define FIX8_FROM_INT(value)    ((fix8_t) ((value) << 8))
+#define FIX8_TO_INT(value)      ((int16_t) ((value) >> 8))
+#define FIX8_FRAC(value)        ((value) & 0x00FF)
+
+/* Conversions between fixed point types */
+#define FIX16_TO_FIX8(value)    ((fix8_t) ((value) >> 8))
+#define FIX8_TO_FIX16(value)    ((fix16_t) (value) << 8)
+
+/**
+ * @brief Multiplies two 8.8 fixed point values
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return fix8_t a * b
+ *
+ * @note It uses a single MULS instruction
+ */
+fix8_t fix8_mul(const fix8_t a, const fix8_t b);
+
+/**
+ * @brief Divides two 8.8 fixed point values
+ *
+ * @param a Dividend
+ * @param b Divisor, must not be 0
+ * @return fix8_t a / b
+ *
+ * @note It uses a single DIVS instruction, so it is better to avoid it in per
+ * object hot paths. The result must fit in 8.8, otherwise it is undefined.
+ */
+fix8_t fix8_div(const fix8_t a, const fix8_t b);
+
+/**
+ * @brief Multiplies two 16.16 fixed point values
+ *
+ * The product is built from 16 bits partial products (MULU instructions), so
+ * no 64 bits math routines are needed.
+ *
+ * @param a First operand
+ * @param b Second operand
+ * @return fix16_t a * b
+ */
+fix16_t fix16_mul(const fix16_t a, const fix16_t b);
+
+/**
+ * @brief Multiplies a 16.16 fixed point value by an 8.8 one
+ *
+ * Useful to scale positions or speeds by ratios (parallax factors, sine and
+ * cosine values, etc) with just two MULU instructions.
+ *
+ * @param a 16.16 fixed point operand
+ * @param b 8.8 fixed point operand
+ * @return fix16_t a * b
+ */
+fix16_t fix16_mul_fix8(const fix16_t a, const fix8_t b);
+
+/**
+ * @brief Divides a 16.16 fixed point value by a small integer
+ *
+ * The division is done multiplying by the reciprocal of the divisor taken from
+ * a lookup table, so no DIVS instructions are used.
+ *
+ * @param a Dividend
+ * @param n Divisor, from 1 to 255
+ * @return fix16_t a / n
+ *
+ * @note Reciprocals are 0.32 fixed point rounded up, so the result can be 1/65536
+ * (one unit in the last fractional bit) greater in magnitude than the exact
+ * division, never more. It takes four MULU instructions.
+ */
+fix16_t fix16_div_int(const fix16_t a, const uint8_t n);
+
+/**
+ * @brief Gets the sine of an angle in 16.16 fixed point
+ *
+ * @param angle Angle in FIX_ANGLE_STEPS per turn, it wraps around
+ * @return fix16_t Sine of the angle
+ */
+fix16_t fix16_sin(const fix_angle_t angle);
+
+/**
+ * @brief Gets the cosine of an angle in 16.16 fixed point
+ *
+ * @param angle Angle in FIX_ANGLE_STEPS per turn, it wraps around
+ * @return fix16_t Cosine of the angle
+ */
+fix16_t fix16_cos(const fix_angle_t angle);
+
+/**
+ * @brief Gets the sine of an angle in 8.8 fixed point
+ *
+ * @param angle Angle in FIX_ANGLE_STEPS per turn, it wraps around
+ * @return fix8_t Sine of the angle
+ */
+fix8_t fix8_sin(const fix_angle_t angle);
+
+/**
+ * @brief Gets the cosine of an angle in 8.8 fixed point
+ *
+ * @param angle Angle in FIX_ANGLE_STEPS per turn, it wraps around
+ * @return fix8_t Cosine of the angle
+ */
+fix8_t fix8_cos(const fix_angle_t angle);
+
+/**
+ * @brief Gets the angle of a vector
+ *
+ * Calculates the angle of the vector (x, y) using the arc tangent table. It is
+ * the inverse of the sine and cosine functions, so a vector built as
+ * (cos(angle), sin(angle)) gives back the same angle.
+ * Both components must use the same units (integers, 16.16, 8.8, etc).
+ *
+ * @param y Vertical component of the vector
+ * @param x Horizontal component of the vector
+ * @return fix_angle_t Angle of the vector, 0 if both components are 0
+ *
+ * @note The precision is 1/1024 of a turn, more than enough for aiming and
+ * homing projectiles
+ */
+fix_angle_t fix_atan2(const int32_t y, const int32_t x);
+
+#endif /* FIX_H */
@@ -0,0 +1,204 @@
+#include "fix_tables.h"
+
+const int16_t fix_tables_sin[FIX_TABLES_SIN_SIZE] = {
+         0,    101,    201,    302,    402,    503,    603,    704, 
+       804,    904,   1005,   1105,   1205,   1306,   1406,   1506, 
+      1606,   1706,   1806,   1906,   2006,   2105,   2205,   2305, 
+      2404,   2503,   2603,   2702,   2801,   2900,   2999,   3098, 
+      3196,   3295,   3393,   3492,   3590,   3688,   3786,   3883, 
+      3981,   4078,   4176,   4273,   4370,   4467,   4563,   4660, 
+      4756,   4852,   4948,   5044,   5139,   5235,   5330,   5425, 
+      5520,   5614,   5708,   5803,   5897,   5990,   6084,   6177, 
+      6270,   6363,   6455,   6547,   6639,   6731,   6823,   6914, 
+      7005,   7096,   7186,   7276,   7366,   7456,   7545,   7635, 
+      7723,   7812,   7900,   7988,   8076,   8163,   8250,   8337, 
+      8423,   8509,   8595,   8680,   8765,   8850,   8935,   9019, 
+      9102,   9186,   9269,   9352,   9434,   9516,   9598,   9679, 
+      9760,   9841,   9921,  10001,  10080,  10159,  10238,  10316, 
+     10394,  10471,  10549,  10625,  10702,  10778,  10853,  10928, 
+     11003,  11077,  11151,  11224,  11297,  11370,  11442,  11514, 
+     11585,  11656,  11727,  11797,  11866,  11935,  12004,  12072, 
+     12140,  12207,  12274,  12340,  12406,  12472,  12537,  12601, 
+     12665,  12729,  12792,  12854,  12916,  12978,  13039,  13100, 
+     13160,  13219,  13279,  13337,  13395,  13453,  13510,  13567, 
+     13623,  13678,  13733,  13788,  13842,  13896,  13949,  14001, 
+     14053,  14104,  14155,  14206,  14256,  14305,  14354,  14402, 
+     14449,  14497,  14543,  14589,  14635,  14680,  14724,  14768, 
+     14811,  14854,  14896,  14937,  14978,  15019,  15059,  15098, 
+     15137,  15175,  15213,  15250,  15286,  15322,  15357,  15392, 
+     15426,  15460,  15493,  15525,  15557,  15588,  15619,  15649, 
+     15679,  15707,  15736,  15763,  15791,  15817,  15843,  15868, 
+     15893,  15917,  15941,  15964,  15986,  16008,  16029,  16049, 
+     16069,  16088,  16107,  16125,  16143,  16160,  16176,  16192, 
+     16207,  16221,  16235,  16248,  16261,  16273,  16284,  16295, 
+     16305,  16315,  16324,  16332,  16340,  16347,  16353,  16359, 
+     16364,  16369,  16373,  16376,  16379,  16381,  16383,  16384, 
+     16384,  16384,  16383,  16381,  16379,  16376,  16373,  16369, 
+     16364,  16359,  16353,  16347,  16340,  16332,  16324,  16315, 
+     16305,  16295,  16284,  16273,  16261,  16248,  16235,  16221, 
+     16207,  16192,  16176,  16160,  16143,  16125,  16107,  16088, 
+     16069,  16049,  16029,  16008,  15986,  15964,  15941,  15917, 
+     15893,  15868,  15843,  15817,  15791,  15763,  15736,  15707, 
+     15679,  15649,  15619,  15588,  15557,  15525,  15493,  15460, 
+     15426,  15392,  15357,  15322,  15286,  15250,  15213,  15175, 
+     15137,  15098,  15059,  15019,  14978,  14937,  14896,  14854, 
+     14811,  14768,  14724,  14680,  14635,  14589,  14543,  14497, 
+     14449,  14402,  14354,  14305,  14256,  14206,  14155,  14104, 
+     14053,  14001,  13949,  13896,  13842,  13788,  13733,  13678, 
+     13623,  13567,  13510,  13453,  13395,  13337,  13279,  13219, 
+     13160,  13100,  13039,  12978,  12916,  12854,  12792,  12729, 
+     12665,  12601,  12537,  12472,  12406,  12340,  12274,  12207, 
+     12140,  12072,  12004,  11935,  11866,  11797,  11727,  11656, 
+     11585,  11514,  11442,  11370,  11297,  11224,  11151,  11077, 
+     11003,  10928,  10853,  10778,  10702,  10625,  10549,  10471, 
+     10394,  10316,  10238,  10159,  10080,  10001,   9921,   9841, 
+      9760,   9679,   9598,   9516,   9434,   9352,   9269,   9186, 
+      9102,   9019,   8935,   8850,   8765,   8680,   8595,   8509, 
+      8423,   8337,   8250,   8163,   8076,   7988,   7900,   7812, 
+      7723,   7635,   7545,   7456,   7366,   7276,   7186,   7096, 
+      7005,   6914,   6823,   6731,   6639,   6547,   6455,   6363, 
+      6270,   6177,   6084,   5990,   5897,   5803,   5708,   5614, 
+      5520,   5425,   5330,   5235,   5139,   5044,   4948,   4852, 
+      4756,   4660,   4563,   4467,   4370,   4273,   4176,   4078, 
+      3981,   3883,   3786,   3688,   3590,   3492,   3393,   3295, 
+      3196,   3098,   2999,   2900,   2801,   2702,   2603,   2503, 
+      2404,   2305,   2205,   2105,   2006,   1906,   1806,   1706, 
+      1606,   1506,   1406,   1306,   1205,   1105,   1005,    904, 
+       804,    704,    603,    503,    402,    302,    201,    101, 
+         0,   -101,   -201,   -302,   -402,   -503,   -603,   -704, 
+      -804,   -904,  -1005,  -1105,  -1205,  -1306,  -1406,  -1506, 
+     -1606,  -1706,  -1806,  -1906,  -2006,  -2105,  -2205,  -2305, 
+     -2404,  -2503,  -2603,  -2702,  -2801,  -2900,  -2999,  -3098, 
+     -3196,  -3295,  -3393,  -3492,  -3590,  -3688,  -3786,  -3883, 
+     -3981,  -4078,  -4176,  -4273,  -4370,  -4467,  -4563,  -4660, 
+     -4756,  -4852,  -4948,  -5044,  -5139,  -5235,  -5330,  -5425, 
+     -5520,  -5614,  -5708,  -5803,  -5897,  -5990,  -6084,  -6177, 
+     -6270,  -6363,  -6455,  -6547,  -6639,  -6731,  -6823,  -6914, 
+     -7005,  -7096,  -7186,  -7276,  -7366,  -7456,  -7545,  -7635, 
+     -7723,  -7812,  -7900,  -7988,  -8076,  -8163,  -8250,  -8337, 
+     -8423,  -8509,  -8595,  -8680,  -8765,  -8850,  -8935,  -9019, 
+     -9102,  -9186,  -9269,  -9352,  -9434,  -9516,  -9598,  -9679, 
+     -9760,  -9841,  -9921, -10001, -10080, -10159, -10238, -10316, 
+    -10394, -10471, -10549, -10625, -10702, -10778, -10853, -10928, 
+    -11003, -11077, -11151, -11224, -11297, -11370, -11442, -11514, 
+    -11585, -11656, -11727, -11797, -11866, -11935, -12004, -12072, 
+    -12140, -12207, -12274, -12340, -12406, -12472, -12537, -12601, 
+    -12665, -12729, -12792, -12854, -12916, -12978, -13039, -13100, 
+    -13160, -13219, -13279, -13337, -13395, -13453, -13510, -13567, 
+    -13623, -13678, -13733, -13788, -13842, -13896, -13949, -14001, 
+    -14053, -14104, -14155, -14206, -14256, -14305, -14354, -14402, 
+    -14449, -14497, -14543, -14589, -14635, -14680, -14724, -14768, 
+    -14811, -14854, -14896, -14937, -14978, -15019, -15059, -15098, 
+    -15137, -15175, -15213, -15250, -15286, -15322, -15357, -15392, 
+    -15426, -15460, -15493, -15525, -15557, -15588, -15619, -15649, 
+    -15679, -15707, -15736, -15763, -15791, -15817, -15843, -15868, 
+    -15893, -15917, -15941, -15964, -15986, -16008, -16029, -16049, 
+    -16069, -16088, -16107, -16125, -16143, -16160, -16176, -16192, 
+    -16207, -16221, -16235, -16248, -16261, -16273, -16284, -16295, 
+    -16305, -16315, -16324, -16332, -16340, -16347, -16353, -16359, 
+    -16364, -16369, -16373, -16376, -16379, -16381, -16383, -16384, 
+    -16384, -16384, -16383, -16381, -16379, -16376, -16373, -16369, 
+    -16364, -16359, -16353, -16347, -16340, -16332, -16324, -16315, 
+    -16305, -16295, -16284, -16273, -16261, -16248, -16235, -16221, 
+    -16207, -16192, -16176, -16160, -16143, -16125, -16107, -16088, 
+    -16069, -16049, -16029, -16008, -15986, -15964, -15941, -15917, 
+    -15893, -15868, -15843, -15817, -15791, -15763, -15736, -15707, 
+    -15679, -15649, -15619, -15588, -15557, -15525, -15493, -15460, 
+    -15426, -15392, -15357, -15322, -15286, -15250, -15213, -15175, 
+    -15137, -15098, -15059, -15019, -14978, -14937, -14896, -14854, 
+    -14811, -14768, -14724, -14680, -14635, -14589, -14543, -14497, 
+    -14449, -14402, -14354, -14305, -14256, -14206, -14155, -14104, 
+    -14053, -14001, -13949, -13896, -13842, -13788, -13733, -13678, 
+    -13623, -13567, -13510, -13453, -13395, -13337, -13279, -13219, 
+    -13160, -13100, -13039, -12978, -12916, -12854, -12792, -12729, 
+    -12665, -12601, -12537, -12472, -12406, -12340, -12274, -12207, 
+    -12140, -12072, -12004, -11935, -11866, -11797, -11727, -11656, 
+    -11585, -11514, -11442, -11370, -11297, -11224, -11151, -11077, 
+    -11003, -10928, -10853, -10778, -10702, -10625, -10549, -10471, 
+    -10394, -10316, -10238, -10159, -10080, -10001,  -9921,  -9841, 
+     -9760,  -9679,  -9598,  -9516,  -9434,  -9352,  -9269,  -9186, 
+     -9102,  -9019,  -8935,  -8850,  -8765,  -8680,  -8595,  -8509, 
+     -8423,  -8337,  -8250,  -8163,  -8076,  -7988,  -7900,  -7812, 
+     -7723,  -7635,  -7545,  -7456,  -7366,  -7276,  -7186,  -7096, 
+     -7005,  -6914,  -6823,  -6731,  -6639,  -6547,  -6455,  -6363, 
+     -6270,  -6177,  -6084,  -5990,  -5897,  -5803,  -5708,  -5614, 
+     -5520,  -5425,  -5330,  -5235,  -5139,  -5044,  -4948,  -4852, 
+     -4756,  -4660,  -4563,  -4467,  -4370,  -4273,  -4176,  -4078, 
+     -3981,  -3883,  -3786,  -3688,  -3590,  -3492,  -3393,  -3295, 
+     -3196,  -3098,  -2999,  -2900,  -2801,  -2702,  -2603,  -2503, 
+     -2404,  -2305,  -2205,  -2105,  -2006,  -1906,  -1806,  -1706, 
+     -1606,  -1506,  -1406,  -1306,  -1205,  -1105,  -1005,   -904, 
+      -804,   -704,   -603,   -503,   -402,   -302,   -201,   -101
+};
+
+const uint16_t fix_tables_atan[FIX_TABLES_ATAN_SIZE] = {
+         0,      1,      1,      2,      3,      3,      4,      4, 
+         5,      6,      6,      7,      8,      8,      9,     10, 
+        10,     11,     11,     12,     13,     13,     14,     15, 
+        15,     16,     16,     17,     18,     18,     19,     20, 
+        20,     21,     22,     22,     23,     23,     24,     25, 
+        25,     26,     27,     27,     28,     28,     29,     30, 
+        30,     31,     31,     32,     33,     33,     34,     34, 
+        35,     36,     36,     37,     38,     38,     39,     39, 
+        40,     41,     41,     42,     42,     43,     44,     44, 
+        45,     45,     46,     46,     47,     48,     48,     49, 
+        49,     50,     51,     51,     52,     52,     53,     53, 
+        54,     55,     55,     56,     56,     57,     57,     58, 
+        58,     59,     60,     60,     61,     61,     62,     62, 
+        63,     63,     64,     65,     65,     66,     66,     67, 
+        67,     68,     68,     69,     69,     70,     70,     71, 
+        71,     72,     72,     73,     74,     74,     75,     75, 
+        76,     76,     77,     77,     78,     78,     79,     79, 
+        80,     80,     81,     81,     82,     82,     83,     83, 
+        84,     84,     84,     85,     85,     86,     86,     87, 
+        87,     88,     88,     89,     89,     90,     90,     91, 
+        91,     91,     92,     92,     93,     93,     94,     94, 
+        95,     95,     96,     96,     96,     97,     97,     98, 
+        98,     99,     99,     99,    100,    100,    101,    101, 
+       102,    102,    102,    103,    103,    104,    104,    104, 
+       105,    105,    106,    106,    106,    107,    107,    108, 
+       108,    108,    109,    109,    110,    110,    110,    111, 
+       111,    112,    112,    112,    113,    113,    113,    114, 
+       114,    115,    115,    115,    116,    116,    116,    117, 
+       117,    118,    118,    118,    119,    119,    119,    120, 
+       120,    120,    121,    121,    121,    122,    122,    122, 
+       123,    123,    123,    124,    124,    124,    125,    125, 
+       125,    126,    126,    126,    127,    127,    127,    128, 
+       128
+};
+
+const uint32_t fix_tables_recip[FIX_TABLES_RECIP_SIZE] = {
+         0,      0, 2147483648, 1431655766, 1073741824, 858993460, 715827883, 613566757, 
+    536870912, 477218589, 429496730, 390451573, 357913942, 330382100, 306783379, 286331154, 
+    268435456, 252645136, 238609295, 226050911, 214748365, 204522253, 195225787, 186737709, 
+    178956971, 171798692, 165191050, 159072863, 153391690, 148102321, 143165577, 138547333, 
+    134217728, 130150525, 126322568, 122713352, 119304648, 116080198, 113025456, 110127367, 
+    107374183, 104755300, 102261127, 99882961, 97612894, 95443718, 93368855, 91382283, 
+    89478486, 87652394, 85899346, 84215046, 82595525, 81037119, 79536432, 78090315, 
+    76695845, 75350304, 74051161, 72796056, 71582789, 70409300, 69273667, 68174085, 
+    67108864, 66076420, 65075263, 64103990, 63161284, 62245903, 61356676, 60492498, 
+    59652324, 58835169, 58040099, 57266231, 56512728, 55778797, 55063684, 54366675, 
+    53687092, 53024288, 52377650, 51746594, 51130564, 50529028, 49941481, 49367441, 
+    48806447, 48258060, 47721859, 47197443, 46684428, 46182445, 45691142, 45210183, 
+    44739243, 44278014, 43826197, 43383509, 42949673, 42524429, 42107523, 41698712, 
+    41297763, 40904451, 40518560, 40139882, 39768216, 39403370, 39045158, 38693400, 
+    38347923, 38008561, 37675152, 37347542, 37025581, 36709123, 36398028, 36092163, 
+    35791395, 35495598, 35204650, 34918434, 34636834, 34359739, 34087043, 33818641, 
+    33554432, 33294321, 33038210, 32786010, 32537632, 32292988, 32051995, 31814573, 
+    31580642, 31350127, 31122952, 30899046, 30678338, 30460761, 30246249, 30034737, 
+    29826162, 29620465, 29417585, 29217465, 29020050, 28825284, 28633116, 28443493, 
+    28256364, 28071682, 27889399, 27709467, 27531842, 27356480, 27183338, 27012373, 
+    26843546, 26676816, 26512144, 26349493, 26188825, 26030105, 25873297, 25718368, 
+    25565282, 25414008, 25264514, 25116768, 24970741, 24826401, 24683721, 24542671, 
+    24403224, 24265352, 24129030, 23994231, 23860930, 23729102, 23598722, 23469767, 
+    23342214, 23216040, 23091223, 22967740, 22845571, 22724695, 22605092, 22486740, 
+    22369622, 22253717, 22139007, 22025474, 21913099, 21801865, 21691755, 21582751, 
+    21474837, 21367997, 21262215, 21157475, 21053762, 20951060, 20849356, 20748635, 
+    20648882, 20550083, 20452226, 20355296, 20259280, 20164166, 20069941, 19976593, 
+    19884108, 19792477, 19701685, 19611723, 19522579, 19434242, 19346700, 19259944, 
+    19173962, 19088744, 19004281, 18920561, 18837576, 18755316, 18673771, 18592933, 
+    18512791, 18433337, 18354562, 18276457, 18199014, 18122225, 18046082, 17970575, 
+    17895698, 17821442, 17747799, 17674763, 17602325, 17530479, 17459217, 17388532, 
+    17318417, 17248865, 17179870, 17111424, 17043522, 16976156, 16909321, 16843010
+};
+
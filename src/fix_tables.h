@@ -0,0 +1,18 @@
+/* Generated with fixtabletool v0.02                     */
+/* A fixed point math tables generator                   */
+/* Github: https://github.com/tapule/mddev               */
+
+#ifndef FIX_TABLES_H
+#define FIX_TABLES_H
+
+#include <stdint.h>
+
+#define FIX_TABLES_SIN_SIZE    1024
+#define FIX_TABLES_ATAN_SIZE    257
+#define FIX_TABLES_RECIP_SIZE    256
+
+extern const int16_t fix_tables_sin[FIX_TABLES_SIN_SIZE];
+extern const uint16_t fix_tables_atan[FIX_TABLES_ATAN_SIZE];
+extern const uint32_t fix_tables_recip[FIX_TABLES_RECIP_SIZE];
+
+#endif /* FIX_TABLES_H */
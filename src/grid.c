@@ -0,0 +1,320 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: grid.c
+ * Uniform grid for broad-phase collision detection
+ */
+
+#include "grid.h"
+#include "config.h"
+
+/* Number of cells in the grid */
+#define GRID_CELLS  (GRID_COLS * GRID_ROWS)
+
+/* Cell entries store object indices as bytes */
+#if GRID_OBJECTS > 256
+#error "GRID_OBJECTS must not be greater than 256"
+#endif
+
+/* Object bounding box and the range of cells it covers */
+typedef struct grid_object_t
+{
+    int16_t x0;         /* Box left coordinate */
+    int16_t y0;         /* Box top coordinate */
+    int16_t x1;         /* Box right coordinate (exclusive) */
+    int16_t y1;         /* Box bottom coordinate (exclusive) */
+    uint16_t id;        /* Object identifier */
+    uint8_t layer;      /* Layers the object belongs to */
+    uint8_t mask;       /* Layers the object collides with */
+    uint8_t col0;       /* First covered column */
+    uint8_t col1;       /* Last covered column */
+    uint8_t row0;       /* First covered row */
+    uint8_t row1;       /* Last covered row */
+} grid_object_t;
+
+/* Objects added in the current frame */
+static grid_object_t grid_objects[GRID_OBJECTS];
+static uint16_t grid_object_count;
+
+/* Cell references used by the added objects */
+static uint16_t grid_entry_count;
+
+/* Objects sorted by cell, cell i uses entries start[i]..start[i + 1] - 1 */
+static uint8_t grid_entries[GRID_ENTRIES];
+static uint16_t grid_cell_start[GRID_CELLS + 1];
+
+/* Pairs found by grid_pairs_find */
+static grid_pair_t grid_pairs[GRID_PAIRS];
+
+/**
+ * @brief Gets the grid column of an horizontal coordinate
+ *
+ * @param x Horizontal coordinate in pixels
+ * @return uint8_t Column clamped to the grid
+ */
+static inline uint8_t grid_col_get(const int16_t x)
+{
+    if (x < 0)
+    {
+        return 0;
+    }
+    if ((x >> GRID_CELL_SHIFT) >= GRID_COLS)
+    {
+        return GRID_COLS - 1;
+    }
+    return x >> GRID_CELL_SHIFT;
+}
+
+/**
+ * @brief Gets the grid row of a vertical coordinate
+ *
+ * @param y Vertical coordinate in pixels
+ * @return uint8_t Row clamped to the grid
+ */
+static inline uint8_t grid_row_get(const int16_t y)
+{
+    if (y < 0)
+    {
+        return 0;
+    }
+    if ((y >> GRID_CELL_SHIFT) >= GRID_ROWS)
+    {
+        return GRID_ROWS - 1;
+    }
+    return y >> GRID_CELL_SHIFT;
+}
+
+void grid_init(void)
+{
+    grid_clear();
+    grid_build();
+}
+
+void grid_clear(void)
+{
+    grid_object_count = 0;
+    grid_entry_count = 0;
+}
+
+bool grid_add(const uint16_t id, const int16_t x, const int16_t y,
+              const uint16_t width, const uint16_t height, const uint8_t layer,
+              const uint8_t mask)
+{
+    grid_object_t *object;
+    uint16_t cells;
+
+    if (grid_object_count >= GRID_OBJECTS || width == 0 || height == 0)
+    {
+        return false;
+    }
+
+    object = &grid_objects[grid_object_count];
+    object->x0 = x;
+    object->y0 = y;
+    object->x1 = x + width;
+    object->y1 = y + height;
+    object->col0 = grid_col_get(x);
+    object->col1 = grid_col_get(object->x1 - 1);
+    object->row0 = grid_row_get(y);
+    object->row1 = grid_row_get(object->y1 - 1);
+
+    /* The object must fit in the free cell references */
+    cells = (object->col1 - object->col0 + 1) * (object->row1 - object->row0 + 1);
+    if (grid_entry_count + cells > GRID_ENTRIES)
+    {
+        return false;
+    }
+
+    object->id = id;
+    object->layer = layer;
+    object->mask = mask;
+    grid_entry_count += cells;
+    ++grid_object_count;
+
+    return true;
+}
+
+void grid_build(void)
+{
+    uint16_t cursor[GRID_CELLS];
+    grid_object_t *object;
+    uint16_t i;
+    uint16_t cell;
+    uint8_t row;
+    uint8_t col;
+
+    for (i = 0; i < GRID_CELLS; ++i)
+    {
+        cursor[i] = 0;
+    }
+
+    /* Count the objects in each cell */
+    object = grid_objects;
+    for (i = 0; i < grid_object_count; ++i)
+    {
+        for (row = object->row0; row <= object->row1; ++row)
+        {
+            cell = row * GRID_COLS;
+            for (col = object->col0; col <= object->col1; ++col)
+            {
+                ++cursor[cell + col];
+            }
+        }
+        ++object;
+    }
+
+    /* Prefix sum to get where each cell starts */
+    grid_cell_start[0] = 0;
+    for (i = 0; i < GRID_CELLS; ++i)
+    {
+        grid_cell_start[i + 1] = grid_cell_start[i] + cursor[i];
+        cursor[i] = grid_cell_start[i];
+    }
+
+    /* Place the objects in their cells */
+    object = grid_objects;
+    for (i = 0; i < grid_object_count; ++i)
+    {
+        for (row = object->row0; row <= object->row1; ++row)
+        {
+            cell = row * GRID_COLS;
+            for (col = object->col0; col <= object->col1; ++col)
+            {
+                grid_entries[cursor[cell + col]++] = i;
+            }
+        }
+        ++object;
+    }
+}
+
+uint16_t grid_pairs_find(void)
+{
+    const grid_object_t *a;
+    const grid_object_t *b;
+    uint16_t count;
+    uint16_t cell;
+    uint16_t i;
+    uint16_t j;
+    uint16_t end;
+    uint8_t row;
+    uint8_t col;
+
+    count = 0;
+    cell = 0;
+    for (row = 0; row < GRID_ROWS; ++row)
+    {
+        for (col = 0; col < GRID_COLS; ++col)
+        {
+            end = grid_cell_start[cell + 1];
+            for (i = grid_cell_start[cell]; i < end; ++i)
+            {
+                a = &grid_objects[grid_entries[i]];
+                for (j = i + 1; j < end; ++j)
+                {
+                    b = &grid_objects[grid_entries[j]];
+
+                    /* Layers filter */
+                    if (!(a->mask & b->layer) && !(b->mask & a->layer))
+                    {
+                        continue;
+                    }
+                    /* AABB overlap test */
+                    if (a->x0 >= b->x1 || b->x0 >= a->x1 ||
+                        a->y0 >= b->y1 || b->y0 >= a->y1)
+                    {
+                        continue;
+                    }
+                    /*
+                     * Objects sharing several cells would be reported several
+                     * times, so the pair is only reported in the cell where the
+                     * overlapping area starts
+                     */
+                    if (grid_col_get(a->x0 > b->x0 ? a->x0 : b->x0) != col ||
+                        grid_row_get(a->y0 > b->y0 ? a->y0 : b->y0) != row)
+                    {
+                        continue;
+                    }
+                    if (count == GRID_PAIRS)
+                    {
+                        return count;
+                    }
+                    grid_pairs[count].a = a->id;
+                    grid_pairs[count].b = b->id;
+                    ++count;
+                }
+            }
+            ++cell;
+        }
+    }
+
+    return count;
+}
+
+inline const grid_pair_t *grid_pairs_get(void)
+{
+    return grid_pairs;
+}
+
+uint16_t grid_query(const int16_t x, const int16_t y, const uint16_t width,
+                    const uint16_t height, const uint8_t mask, uint16_t *ids,
+                    const uint16_t max)
+{
+    const grid_object_t *object;
+    int16_t x1;
+    int16_t y1;
+    uint16_t count;
+    uint16_t i;
+    uint16_t end;
+    uint8_t col0;
+    uint8_t col1;
+    uint8_t row0;
+    uint8_t row1;
+    uint8_t row;
+    uint8_t col;
+
+    x1 = x + width;
+    y1 = y + height;
+    col0 = grid_col_get(x);
+    col1 = grid_col_get(x1 - 1);
+    row0 = grid_row_get(y);
+    row1 = grid_row_get(y1 - 1);
+
+    count = 0;
+    for (row = row0; row <= row1; ++row)
+    {
+        for (col = col0; col <= col1; ++col)
+        {
+            end = grid_cell_start[row * GRID_COLS + col + 1];
+            for (i = grid_cell_start[row * GRID_COLS + col]; i < end; ++i)
+            {
+                object = &grid_objects[grid_entries[i]];
+                if (!(object->layer & mask))
+                {
+                    continue;
+                }
+                if (x >= object->x1 || object->x0 >= x1 ||
+                    y >= object->y1 || object->y0 >= y1)
+                {
+                    continue;
+                }
+                /* Report the object only once, as in grid_pairs_find */
+                if (grid_col_get(x > object->x0 ? x : object->x0) != col ||
+                    grid_row_get(y > object->y0 ? y : object->y0) != row)
+                {
+                    continue;
+                }
+                if (count == max)
+                {
+                    return count;
+                }
+                ids[count] = object->id;
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
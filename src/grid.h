@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: grid.h
+ * Uniform grid for broad-phase collision detection
+ *
+ * Checking all the possible pairs of objects is too slow when there are
+ * hundreds of bullets and enemies on screen. The grid splits the screen in
+ * cells of 2^GRID_CELL_SHIFT pixels and only objects sharing cells are checked
+ * against each other.
+ * Each frame, the objects' bounding boxes are added to the grid and then it is
+ * rebuilt with a counting sort. After that, the overlapping pairs of objects
+ * can be found, and areas can be queried.
+ * Objects belong to layers and have a mask of layers they collide with, so
+ * for instance bullets are never checked against other bullets.
+ * Everything uses static memory, sizes can be tuned in config.h.
+ *
+ * Usage example:
+ *  grid_clear();
+ *  for each object: grid_add(id, x, y, w, h, layer, mask);
+ *  grid_build();
+ *  count = grid_pairs_find();
+ *  pairs = grid_pairs_get();
+ */
+
+#ifndef GRID_H
+#define GRID_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Candidate pair of overlapping objects */
+typedef struct grid_pair_t
+{
+    uint16_t a;     /* Id of the first object */
+    uint16_t b;     /* Id of the second object */
+} grid_pair_t;
+
+/**
+ * @brief Initialises the collision grid
+ *
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void grid_init(void);
+
+/**
+ * @brief Removes all the objects from the grid
+ *
+ * Call it at the start of each frame, before adding the objects.
+ */
+void grid_clear(void);
+
+/**
+ * @brief Adds an object's bounding box to the grid
+ *
+ * Coordinates are in screen pixels. Parts of the box out of the grid area are
+ * clamped to the border cells.
+ *
+ * @param id Object identifier reported in pairs and queries
+ * @param x Box left coordinate
+ * @param y Box top coordinate
+ * @param width Box width in pixels
+ * @param height Box height in pixels
+ * @param layer Layers bit mask the object belongs to
+ * @param mask Layers bit mask the object collides with
+ * @return true if the object was added, false if the grid is full or the box
+ *         is empty
+ */
+bool grid_add(const uint16_t id, const int16_t x, const int16_t y,
+              const uint16_t width, const uint16_t height, const uint8_t layer,
+              const uint8_t mask);
+
+/**
+ * @brief Builds the grid cells from the added objects
+ *
+ * Objects are sorted by cell using a counting sort. Call it once all the
+ * objects of the frame are added.
+ */
+void grid_build(void);
+
+/**
+ * @brief Finds the pairs of overlapping objects
+ *
+ * Only objects sharing cells and whose layers and masks match are checked.
+ * Each overlapping pair is reported only once.
+ *
+ * @return uint16_t Number of pairs found
+ *
+ * @note Pairs exceeding GRID_PAIRS are discarded
+ */
+uint16_t grid_pairs_find(void);
+
+/**
+ * @brief Gets the list of pairs found by grid_pairs_find
+ *
+ * @return const grid_pair_t* Pairs list
+ */
+const grid_pair_t *grid_pairs_get(void);
+
+/**
+ * @brief Finds the objects overlapping an area
+ *
+ * @param x Area left coordinate
+ * @param y Area top coordinate
+ * @param width Area width in pixels
+ * @param height Area height in pixels
+ * @param mask Layers bit mask of the objects to find
+ * @param ids Buffer to store the found objects' ids
+ * @param max Maximum number of ids to store in the buffer
+ * @return uint16_t Number of objects found
+ */
+uint16_t grid_query(const int16_t x, const int16_t y, const uint16_t width,
+                    const uint16_t height, const uint8_t mask, uint16_t *ids,
+                    const uint16_t max);
+
+#endif /* GRID_H */
@@ -0,0 +1,77 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: mapper.c
+ * SSF2 rom bank mapper
+ */
+
+#include "mapper.h"
+#include "config.h"
+#include "dma.h"
+
+/*
+ * Mapper bank registers, one byte per slot at odd addresses:
+ * 0xA130F3 = Slot 1 (0x080000 - 0x0FFFFF)
+ * 0xA130F5 = Slot 2 (0x100000 - 0x17FFFF)
+ * ...
+ * 0xA130FF = Slot 7 (0x380000 - 0x3FFFFF)
+ * Slot 0 has no register, it is always bank 0.
+ */
+#define MAPPER_BANK_PORT    ((volatile uint8_t *) 0xA130F1)
+
+/* Rom bank mapped in each slot, the registers are write only */
+static uint8_t mapper_banks[MAPPER_SLOTS];
+
+void mapper_init(void)
+{
+    uint8_t i;
+
+    mapper_banks[0] = 0;
+    for (i = 1; i < MAPPER_SLOTS; ++i)
+    {
+        MAPPER_BANK_PORT[i * 2] = i;
+        mapper_banks[i] = i;
+    }
+}
+
+inline void mapper_bank_set(const uint8_t slot, const uint8_t bank)
+{
+    MAPPER_BANK_PORT[slot * 2] = bank;
+    mapper_banks[slot] = bank;
+}
+
+inline uint8_t mapper_bank_get(const uint8_t slot)
+{
+    return mapper_banks[slot];
+}
+
+const void *mapper_far_map(const void *far)
+{
+    uint32_t addr = (uint32_t) far;
+    uint8_t bank;
+
+    if (addr < MAPPER_FAR_START)
+    {
+        return far;
+    }
+
+    /* Map the bank and the next one, so the data is seen contiguous */
+    bank = addr >> 19;
+    if (mapper_banks[MAPPER_WINDOW_SLOT] != bank)
+    {
+        mapper_bank_set(MAPPER_WINDOW_SLOT, bank);
+        mapper_bank_set(MAPPER_WINDOW_SLOT + 1, bank + 1);
+    }
+
+    return (const void *) (((uint32_t) MAPPER_WINDOW_SLOT * MAPPER_BANK_SIZE) +
+                           (addr & (MAPPER_BANK_SIZE - 1)));
+}
+
+bool mapper_vram_load(const void *far, const uint16_t dest,
+                      const uint16_t length)
+{
+    return dma_vram_transfer(mapper_far_map(far), dest, length, 2);
+}
@@ -0,0 +1,106 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: mapper.h
+ * SSF2 rom bank mapper
+ *
+ * The m68k can only see 4MB of rom. Bigger roms use the SSF2 mapper (Super
+ * Street Fighter 2 style), which splits the rom in 512KB banks and the 4MB rom
+ * space in 8 slots. The first slot is fixed to bank 0, the others can show any
+ * bank.
+ * The linker script puts the data marked with MAPPER_BANK(n) (n = 8..15) in
+ * the rom bank n, beyond the first 4MB. Their addresses are "far" addresses
+ * which can't be read directly. mapper_far_map maps the banks of a far address
+ * in the mapper window (slots MAPPER_WINDOW_SLOT and MAPPER_WINDOW_SLOT + 1)
+ * and returns a normal pointer to the data. Using two slots, data up to 512KB
+ * is always seen contiguous.
+ *
+ * Usage example:
+ *  const uint8_t res_intro_tiles[] MAPPER_BANK(8) = { ... };
+ *  const uint8_t res_intro_song[] MAPPER_BANK(9) = { ... };
+ *
+ *  mapper_vram_load(res_intro_tiles, 0x0000, sizeof(res_intro_tiles) / 2);
+ *  sound_music_play(mapper_far_map(res_intro_song));
+ *
+ * @note The rom header console name must start with "SEGA SSF" to enable the
+ * mapper in emulators, and the rom end address must include the banks. Data
+ * must stay mapped while it is used: queued DMA transfers, streams or music
+ * and samples played by the z80 (it reads the rom through the same window).
+ * Code and data in the fixed part of the rom must be below the window.
+ *
+ * More info:
+ * https://plutiedev.com/beyond-4mb
+ */
+
+#ifndef MAPPER_H
+#define MAPPER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Rom bank and slot size (512KB) */
+#define MAPPER_BANK_SIZE    0x80000
+/* Number of slots in the 4MB m68k rom space */
+#define MAPPER_SLOTS        8
+/* First far address, the banks after the first 4MB */
+#define MAPPER_FAR_START    0x400000
+
+/* Places a global const variable in a rom bank (8..15) */
+#define MAPPER_BANK(n) __attribute__((section(".bank" #n)))
+
+/**
+ * @brief Initialises the mapper
+ * 
+ * Maps each slot to its own bank (bank n in slot n), like the hardware does at
+ * power on.
+ * 
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void mapper_init(void);
+
+/**
+ * @brief Maps a rom bank in a slot
+ * 
+ * @param slot Slot to change [1..7] (slot 0 is fixed)
+ * @param bank Rom bank to show in the slot [0..63]
+ */
+void mapper_bank_set(const uint8_t slot, const uint8_t bank);
+
+/**
+ * @brief Gets the rom bank mapped in a slot
+ * 
+ * @param slot Slot to check [0..7]
+ * @return uint8_t Rom bank mapped in the slot
+ */
+uint8_t mapper_bank_get(const uint8_t slot);
+
+/**
+ * @brief Maps a far address in the mapper window
+ * 
+ * @param far Far address (i.e. a variable marked with MAPPER_BANK)
+ * @return const void* Pointer to the data in the mapper window, addresses in
+ * the first 4MB are returned unchanged
+ * 
+ * @note The pointer is valid until the window is mapped again
+ */
+const void *mapper_far_map(const void *far);
+
+/**
+ * @brief Loads data from a far address to VRam
+ * 
+ * Maps the data and transfers it to VRam using DMA. The transfer is done when
+ * the function returns, so the window can be mapped again safely.
+ * 
+ * @param far Far address of the data in rom
+ * @param dest Destination address in VRam
+ * @param length Transfer length in words
+ * @return True on success, false otherwise
+ */
+bool mapper_vram_load(const void *far, const uint16_t dest,
+                      const uint16_t length);
+
+#endif /* MAPPER_H */
@@ -12,6 +12,8 @@
 
 void smd_init(void)
 {
+    /* Initialises the rom bank mapper */
+    mapper_init();
     /* Initialises the z80 secondary CPU */
     z80_init();
     /* Initialises gamepad ports */
@@ -24,10 +26,22 @@ void smd_init(void)
     sound_init();
     /* Initialises the graphics  */
     vid_init();
+    /* Initialises the raster effects scheduler */
+    raster_init();
     /* Initialises the pseudo-random number generator */
     rnd_init();
     /* Initialises the DMA system  */
     dma_init();
+    /* Initialises the per frame arena */
+    arena_init();
     /* Initialises the palette system  */
     pal_init();
+    /* Initialises the sprite table */
+    sprite_init();
+    /* Initialises the collision grid */
+    grid_init();
+    /* Initialises the entity system */
+    entity_init();
+    /* Initialises the task scheduler */
+    task_init();
 }
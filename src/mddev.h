@@ -20,6 +20,8 @@
 #include "config.h"
 
 #include "memory.h"
+#include "arena.h"
+#include "pool.h"
 #include "sys.h"
 #include "z80.h"
 #include "pad.h"
@@ -27,11 +29,20 @@
 #include "ym2612.h"
 #include "sound.h"
 #include "video.h"
+#include "raster.h"
 #include "rand.h"
+#include "fix.h"
 #include "dma.h"
 #include "pal.h"
 #include "tiles.h"
 #include "plane.h"
+#include "sprite.h"
+#include "grid.h"
+#include "collmap.h"
+#include "entity.h"
+#include "task.h"
+#include "stream.h"
+#include "mapper.h"
 #include "text.h"
 #include "kdebug.h"
 
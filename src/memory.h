@@ -7,6 +7,10 @@
  * File: memory.h
  * Basic memory utilities
  * 
+ * These utilities are written in m68k assembly (see memory.s). They work with
+ * words, longs and 48 bytes MOVEM bursts whenever the pointers alignment lets
+ * them, so they are much faster than byte by byte loops.
+ * 
  */
 
 #ifndef MEMORY_H
@@ -23,7 +27,18 @@
  * @param value Value used to fill the memory area
  * @param size Amount of bytes to fill
  */
-void mem_set(void *dest, uint8_t value, uint16_t size);
+void mem_set(void *dest, uint8_t value, uint32_t size);
+
+/**
+ * @brief Fill a word aligned memory area with a constant value
+ * 
+ * Acts like mem_set but skips the alignment checks.
+ * 
+ * @param dest Destination memory address (must be even)
+ * @param value Value used to fill the memory area
+ * @param size Amount of bytes to fill
+ */
+void mem_set_fast(void *dest, uint8_t value, uint32_t size);
 
 /**
  * @brief Copy a memory area
@@ -33,7 +48,23 @@ void mem_set(void *dest, uint8_t value, uint16_t size);
  * @param dest Destination memory address
  * @param src Source data
  * @param size Amount of bytes to copy
+ * 
+ * @note Memory areas must not overlap. If source and destination have
+ * different alignments (one odd, one even) the copy is done byte by byte.
+ */
+void mem_copy(void *dest, const void *src, uint32_t size);
+
+/**
+ * @brief Copy a word aligned memory area
+ * 
+ * Acts like mem_copy but skips the size and alignment checks.
+ * 
+ * @param dest Destination memory address (must be even)
+ * @param src Source data (must be even)
+ * @param size Amount of bytes to copy
+ * 
+ * @note Memory areas must not overlap.
  */
-void mem_copy(void *dest, const void *src, uint16_t size);
+void mem_copy_fast(void *dest, const void *src, uint32_t size);
 
 #endif /* MEMORY_H */
@@ -0,0 +1,172 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: memory.s
+ * Basic memory utilities
+ * 
+ * Hand written m68k versions of the memory utilities declared in memory.h.
+ * Byte accesses are slow on the m68k, so these routines align the pointers to
+ * a word boundary and then move 48 bytes per iteration using MOVEM with 12 long
+ * registers. The remaining bytes are moved as longs, a word and a byte.
+ * Arguments are passed on the stack following the GCC m68k calling convention
+ * where d0-d1/a0-a1 are scratch registers and the others must be preserved.
+ */
+
+.section .text
+
+/**
+ * void mem_set(void *dest, uint8_t value, uint32_t size)
+ */
+.global mem_set
+mem_set:
+    move.l  4(sp), a0               /* Destination */
+    move.l  8(sp), d0               /* Fill value in the lower byte */
+    move.l  12(sp), d1              /* Size in bytes */
+    cmpi.l  #16, d1
+    blo.s   mem_set_bytes           /* Short fills are done byte by byte */
+    movem.l d2-d7/a2-a5, -(sp)
+    move.w  a0, d2
+    btst    #0, d2
+    beq.s   mem_set_even
+    move.b  d0, (a0)+               /* Aligns the destination to a word */
+    subq.l  #1, d1
+    bra.s   mem_set_even
+
+/**
+ * void mem_set_fast(void *dest, uint8_t value, uint32_t size)
+ */
+.global mem_set_fast
+mem_set_fast:
+    move.l  4(sp), a0               /* Destination (even address) */
+    move.l  8(sp), d0               /* Fill value in the lower byte */
+    move.l  12(sp), d1              /* Size in bytes */
+    movem.l d2-d7/a2-a5, -(sp)
+mem_set_even:
+    /* Expands the fill value byte to a long */
+    move.b  d0, d2
+    lsl.w   #8, d0
+    move.b  d2, d0
+    move.w  d0, d2
+    swap    d0
+    move.w  d2, d0
+    /* Fills the registers used in the 48 bytes bursts */
+    move.l  d0, d2
+    move.l  d0, d3
+    move.l  d0, d4
+    move.l  d0, d5
+    move.l  d0, d6
+    move.l  d0, d7
+    move.l  d0, a1
+    move.l  d0, a2
+    move.l  d0, a3
+    move.l  d0, a4
+    move.l  d0, a5
+mem_set_burst:
+    subi.l  #48, d1
+    bcs.s   mem_set_burst_end
+    movem.l d0/d2-d7/a1-a5, (a0)    /* 12 longs, 48 bytes */
+    lea     48(a0), a0
+    bra.s   mem_set_burst
+mem_set_burst_end:
+    addi.l  #48, d1                 /* Remaining bytes (0..47) */
+    move.w  d1, d2
+    lsr.w   #2, d2                  /* Remaining longs */
+    bra.s   mem_set_longs_next
+mem_set_longs:
+    move.l  d0, (a0)+
+mem_set_longs_next:
+    dbra    d2, mem_set_longs
+    btst    #1, d1
+    beq.s   mem_set_tail_byte
+    move.w  d0, (a0)+
+mem_set_tail_byte:
+    btst    #0, d1
+    beq.s   mem_set_done
+    move.b  d0, (a0)
+mem_set_done:
+    movem.l (sp)+, d2-d7/a2-a5
+    rts
+
+mem_set_bytes:
+    bra.s   mem_set_bytes_next
+mem_set_bytes_loop:
+    move.b  d0, (a0)+
+mem_set_bytes_next:
+    dbra    d1, mem_set_bytes_loop
+    rts
+
+/**
+ * void mem_copy(void *dest, const void *src, uint32_t size)
+ */
+.global mem_copy
+mem_copy:
+    move.l  4(sp), a1               /* Destination */
+    move.l  8(sp), a0               /* Source */
+    move.l  12(sp), d1              /* Size in bytes */
+    cmpi.l  #16, d1
+    blo.s   mem_copy_bytes          /* Short copies are done byte by byte */
+    movem.l d2-d7/a2-a6, -(sp)
+    move.w  a0, d0
+    move.w  a1, d2
+    eor.w   d2, d0
+    btst    #0, d0
+    bne.s   mem_copy_unaligned      /* Pointers can't be aligned together */
+    btst    #0, d2
+    beq.s   mem_copy_even
+    move.b  (a0)+, (a1)+            /* Aligns both pointers to a word */
+    subq.l  #1, d1
+    bra.s   mem_copy_even
+
+/**
+ * void mem_copy_fast(void *dest, const void *src, uint32_t size)
+ */
+.global mem_copy_fast
+mem_copy_fast:
+    move.l  4(sp), a1               /* Destination (even address) */
+    move.l  8(sp), a0               /* Source (even address) */
+    move.l  12(sp), d1              /* Size in bytes */
+    movem.l d2-d7/a2-a6, -(sp)
+mem_copy_even:
+mem_copy_burst:
+    subi.l  #48, d1
+    bcs.s   mem_copy_burst_end
+    movem.l (a0)+, d0/d2-d7/a2-a6   /* 12 longs, 48 bytes */
+    movem.l d0/d2-d7/a2-a6, (a1)
+    lea     48(a1), a1
+    bra.s   mem_copy_burst
+mem_copy_burst_end:
+    addi.l  #48, d1                 /* Remaining bytes (0..47) */
+    move.w  d1, d2
+    lsr.w   #2, d2                  /* Remaining longs */
+    bra.s   mem_copy_longs_next
+mem_copy_longs:
+    move.l  (a0)+, (a1)+
+mem_copy_longs_next:
+    dbra    d2, mem_copy_longs
+    btst    #1, d1
+    beq.s   mem_copy_tail_byte
+    move.w  (a0)+, (a1)+
+mem_copy_tail_byte:
+    btst    #0, d1
+    beq.s   mem_copy_done
+    move.b  (a0), (a1)
+mem_copy_done:
+    movem.l (sp)+, d2-d7/a2-a6
+    rts
+
+mem_copy_unaligned:
+    movem.l (sp)+, d2-d7/a2-a6
+mem_copy_bytes:
+    subq.l  #1, d1
+    bcs.s   mem_copy_bytes_end      /* Nothing to copy */
+mem_copy_bytes_loop:
+    move.b  (a0)+, (a1)+
+    dbra    d1, mem_copy_bytes_loop
+    /* dbra only counts the lower word, continue with the upper one */
+    subi.l  #0x10000, d1
+    bcc.s   mem_copy_bytes_loop
+mem_copy_bytes_end:
+    rts
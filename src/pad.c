@@ -72,6 +72,7 @@ void pad_update(void)
     pad_state_old[PAD_1] = pad_state[PAD_1];
     pad_state_old[PAD_2] = pad_state[PAD_2];
 
+    z80_prof_site_set(Z80_PROF_PAD);
     z80_bus_request_fast();
     /* 1st step read:
      * | ?| ?| C| B| R| L| D| U|
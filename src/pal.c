@@ -8,17 +8,68 @@
  * Palette routines
  */
 
+#include <stddef.h>
 #include "pal.h"
+#include "config.h"
 #include "video.h"
 #include "dma.h"
 
+/*
+ * Brightness level of a color component (0..7) for a fade level (0..8) where
+ * level 8 is the original component and level 0 is black or white.
+ */
+#define PAL_LUT_BLACK(c, l)     (((c) * (l) + 4) >> 3)
+#define PAL_LUT_WHITE(c, l)     (7 - (((7 - (c)) * (l) + 4) >> 3))
+/* Row of the 8 component values already shifted to their color position */
+#define PAL_LUT_ROW(f, l, s)    { f(0, l) << (s), f(1, l) << (s), \
+                                  f(2, l) << (s), f(3, l) << (s), \
+                                  f(4, l) << (s), f(5, l) << (s), \
+                                  f(6, l) << (s), f(7, l) << (s) }
+/* Red, green and blue rows for a fade level */
+#define PAL_LUT_LEVEL(f, l)     { PAL_LUT_ROW(f, l, 1), PAL_LUT_ROW(f, l, 5), \
+                                  PAL_LUT_ROW(f, l, 9) }
+/* Fade levels in the brightness tables */
+#define PAL_LUT_LEVELS          9
+
+/* Brightness tables for fades to or from black, built at compile time */
+static const uint16_t pal_fade_lut_black[PAL_LUT_LEVELS][3][8] = {
+    PAL_LUT_LEVEL(PAL_LUT_BLACK, 0), PAL_LUT_LEVEL(PAL_LUT_BLACK, 1),
+    PAL_LUT_LEVEL(PAL_LUT_BLACK, 2), PAL_LUT_LEVEL(PAL_LUT_BLACK, 3),
+    PAL_LUT_LEVEL(PAL_LUT_BLACK, 4), PAL_LUT_LEVEL(PAL_LUT_BLACK, 5),
+    PAL_LUT_LEVEL(PAL_LUT_BLACK, 6), PAL_LUT_LEVEL(PAL_LUT_BLACK, 7),
+    PAL_LUT_LEVEL(PAL_LUT_BLACK, 8)
+};
+
+/* Brightness tables for fades to or from white, built at compile time */
+static const uint16_t pal_fade_lut_white[PAL_LUT_LEVELS][3][8] = {
+    PAL_LUT_LEVEL(PAL_LUT_WHITE, 0), PAL_LUT_LEVEL(PAL_LUT_WHITE, 1),
+    PAL_LUT_LEVEL(PAL_LUT_WHITE, 2), PAL_LUT_LEVEL(PAL_LUT_WHITE, 3),
+    PAL_LUT_LEVEL(PAL_LUT_WHITE, 4), PAL_LUT_LEVEL(PAL_LUT_WHITE, 5),
+    PAL_LUT_LEVEL(PAL_LUT_WHITE, 6), PAL_LUT_LEVEL(PAL_LUT_WHITE, 7),
+    PAL_LUT_LEVEL(PAL_LUT_WHITE, 8)
+};
+
+/* Defines a palette color cycle operation */
+typedef struct pal_cycle
+{
+    uint8_t index;      /* First color of the range in the buffers */
+    uint8_t count;      /* Colors in the range, 0 if the cycle is stopped */
+    uint8_t speed;      /* Speed in frames between color rotations */
+    uint8_t counter;    /* Frame counter */
+    bool reverse;       /* Rotates towards lower indexes */
+} pal_cycle_t;
+
 /* Internal palette color buffers */
 static uint16_t pal_buffers[2][64];
 static uint16_t *pal_primary;
 static uint16_t *pal_alternate;
 
-/* Should us update CRAM with the primary buffer? */
-static bool pal_update_needed;
+/*
+ * Palette lines of the primary buffer changed since the last CRAM upload. Each
+ * bit represents a palette line (bit 0 = PAL_0 .. bit 3 = PAL_3), so only the
+ * modified spans are uploaded to CRAM.
+ */
+static uint8_t pal_dirty_lines;
 
 /* Is there a fade operation running? */
 static bool pal_fading;
@@ -26,22 +77,164 @@ static bool pal_fading;
 static uint8_t pal_fade_speed;
 /* Fade operation frame counter */
 static uint8_t pal_fade_counter;
+/* Brightness tables used by a table driven fade, NULL on regular fades */
+static const uint16_t (*pal_fade_lut)[3][8];
+/* Current, final and increment of brightness levels on table driven fades */
+static int16_t pal_fade_level;
+static int16_t pal_fade_level_end;
+static int16_t pal_fade_level_inc;
+
+/* Palette color cycles and number of them running */
+static pal_cycle_t pal_cycles[PAL_CYCLE_SIZE];
+static uint16_t pal_cycles_running;
+
+/**
+ * @brief Marks as dirty the palette lines touched by a range of colors
+ * 
+ * @param index First color of the range (0..63)
+ * @param count Number of colors in the range (0..64, 0 marks nothing)
+ */
+static inline void pal_dirty_mark(const uint16_t index, const uint16_t count)
+{
+    uint16_t first_line = index >> 4;
+    uint16_t last_line;
+
+    if (!count)
+    {
+        return;
+    }
+    last_line = (index + count - 1) >> 4;
+    /* Sets bits first_line..last_line in the dirty mask */
+    pal_dirty_lines |= ((1 << (last_line + 1)) - 1) & ~((1 << first_line) - 1);
+}
+
+/**
+ * @brief Uploads a span of contiguous palette lines from the primary buffer
+ * 
+ * The upload is pushed into the DMA queue. If the queue is full, it is done
+ * immediately instead.
+ * 
+ * @param line First palette line to upload (0..3)
+ * @param count Number of palette lines to upload (1..4)
+ */
+static inline void pal_lines_upload(const uint16_t line, const uint16_t count)
+{
+    /* Each line has 16 colors (words). CRAM addresses are in bytes */
+    if (!dma_queue_cram_transfer(&pal_primary[line << 4], line << 5,
+                                 count << 4, 2))
+    {
+        dma_cram_transfer_fast(&pal_primary[line << 4], line << 5,
+                               count << 4, 2);
+    }
+}
+
+/**
+ * @brief Rotates one position a range of colors in a color buffer
+ * 
+ * @param buffer Color buffer to rotate
+ * @param count Number of colors in the range
+ * @param reverse Rotates towards lower indexes
+ */
+static inline void pal_range_rotate(uint16_t *buffer, uint16_t count,
+                                    const bool reverse)
+{
+    uint16_t color;
+
+    /* The rotation moves count - 1 colors and wraps the remaining one */
+    --count;
+    if (reverse)
+    {
+        color = *buffer;
+        while (count--)
+        {
+            *buffer = *(buffer + 1);
+            ++buffer;
+        }
+        *buffer = color;
+    }
+    else
+    {
+        buffer += count;
+        color = *buffer;
+        while (count--)
+        {
+            *buffer = *(buffer - 1);
+            --buffer;
+        }
+        *buffer = color;
+    }
+}
+
+/**
+ * @brief Advances the running palette cycles one frame
+ * 
+ */
+static inline void pal_cycles_step(void)
+{
+    pal_cycle_t *cycle = pal_cycles;
+    uint16_t i = PAL_CYCLE_SIZE;
+
+    while (i)
+    {
+        --i;
+        if (cycle->count)
+        {
+            ++cycle->counter;
+            if (cycle->counter >= cycle->speed)
+            {
+                cycle->counter = 0;
+                pal_range_rotate(&pal_primary[cycle->index], cycle->count,
+                                 cycle->reverse);
+                pal_range_rotate(&pal_alternate[cycle->index], cycle->count,
+                                 cycle->reverse);
+                pal_dirty_mark(cycle->index, cycle->count);
+            }
+        }
+        ++cycle;
+    }
+}
+
+/**
+ * @brief Builds the primary buffer from the alternate one at the current table
+ *        driven fade brightness level
+ * 
+ */
+static void pal_fade_table_apply(void)
+{
+    const uint16_t (*lut)[8] = pal_fade_lut[pal_fade_level];
+    uint16_t i = 64;
+    uint16_t color;
+
+    while (i)
+    {
+        /* Adjust the index to use 0..63 instead of 1..64 */
+        --i;
+        /* One table access per component, no compares nor branches */
+        color = pal_alternate[i];
+        pal_primary[i] = lut[0][(color & 0x00E) >> 1] |
+                         lut[1][(color & 0x0E0) >> 5] |
+                         lut[2][(color & 0xE00) >> 9];
+    }
+    pal_dirty_lines = 0x0F;
+}
 
 void pal_init(void)
 {
     pal_primary = &pal_buffers[0][0];
     pal_alternate = &pal_buffers[1][0];
-    pal_update_needed = false;
+    pal_dirty_lines = 0;
     pal_fading = false;
     pal_fade_speed = 0;
     pal_fade_counter = 0;
+    pal_fade_lut = NULL;
+    pal_cycle_stop_all();
 }
 
 void pal_primary_set(const uint16_t index, uint16_t count,
                      const uint16_t *restrict colors)
 {
-    /* We update the primary buffer, so we need to update CRAM */
-    pal_update_needed = true;
+    /* We update the primary buffer, so we need to update its CRAM lines */
+    pal_dirty_mark(index, count);
 
     while (count)
     {
@@ -78,11 +271,44 @@ inline void pal_swap(void)
     pal_primary = pal_alternate;
     pal_alternate = tmp;
 
-    pal_update_needed = true;
+    /* The whole primary buffer changed */
+    pal_dirty_lines = 0x0F;
 }
 
 inline void pal_fade(const uint16_t speed)
 {
+    /* Fade operation setup */
+    pal_fade_speed = speed;
+    pal_fade_counter = 0;
+    pal_fade_lut = NULL;
+    pal_fading = true;
+}
+
+void pal_fade_table(const uint16_t speed, const pal_fade_type_t type)
+{
+    uint16_t i;
+
+    pal_fade_lut = (type & 0x02) ? pal_fade_lut_white : pal_fade_lut_black;
+    if (type & 0x01)
+    {
+        /* Fades out the current colors, so they are the base colors */
+        for (i = 0; i < 64; ++i)
+        {
+            pal_alternate[i] = pal_primary[i];
+        }
+        pal_fade_level = PAL_LUT_LEVELS - 1;
+        pal_fade_level_end = 0;
+        pal_fade_level_inc = -1;
+    }
+    else
+    {
+        pal_fade_level = 0;
+        pal_fade_level_end = PAL_LUT_LEVELS - 1;
+        pal_fade_level_inc = 1;
+    }
+    /* First step is shown immediately at level 0 or 8 */
+    pal_fade_table_apply();
+
     /* Fade operation setup */
     pal_fade_speed = speed;
     pal_fade_counter = 0;
@@ -94,6 +320,7 @@ bool pal_fade_step(void)
     uint16_t i = 64;
     uint16_t primary_component;
     uint16_t alternate_component;
+    uint8_t changed_lines;
 
     if (!pal_fading)
     {
@@ -104,7 +331,20 @@ bool pal_fade_step(void)
     if (pal_fade_counter == pal_fade_speed)
     {
         pal_fade_counter = 0;
-        pal_update_needed = false;
+        /* Table driven fades have their own constant time step */
+        if (pal_fade_lut)
+        {
+            /* The last brightness level was applied in the previous step */
+            if (pal_fade_level == pal_fade_level_end)
+            {
+                pal_fading = false;
+                return false;
+            }
+            pal_fade_level += pal_fade_level_inc;
+            pal_fade_table_apply();
+            return true;
+        }
+        changed_lines = 0;
         while (i)
         {
             /* Adjust the index to use 0..63 instead of 1..64 */
@@ -114,7 +354,7 @@ bool pal_fade_step(void)
             alternate_component = pal_alternate[i] & 0x00E;
             if (primary_component != alternate_component)
             {
-                pal_update_needed = true;
+                changed_lines |= 1 << (i >> 4);
                 pal_primary[i] += primary_component < alternate_component ? 0x002 : -0x002;
             }
             /* Updates green component in the primary color buffer */
@@ -122,7 +362,7 @@ bool pal_fade_step(void)
             alternate_component = pal_alternate[i] & 0x0E0;
             if (primary_component != alternate_component)
             {
-                pal_update_needed = true;
+                changed_lines |= 1 << (i >> 4);
                 pal_primary[i] += primary_component < alternate_component ? 0x020 : -0x020;
             }
             /* Updates blue component  in the primary color buffer */
@@ -130,16 +370,18 @@ bool pal_fade_step(void)
             alternate_component = pal_alternate[i] & 0xE00;
             if (primary_component != alternate_component)
             {
-                pal_update_needed = true;
+                changed_lines |= 1 << (i >> 4);
                 pal_primary[i] += primary_component < alternate_component ? 0x200 : -0x200;
             }
         }
         /* No color change in this step, so the fade operation ended */
-        if (!pal_update_needed)
+        if (!changed_lines)
         {
             pal_fading = false;
             return false;
         }
+        /* Only the lines that changed in this step need to be uploaded */
+        pal_dirty_lines |= changed_lines;
     }
     /* The fade operation still running */
     return true;
@@ -156,6 +398,7 @@ void pal_fade_wait(void)
     {
         vid_vsync_wait();
         pal_update();
+        dma_queue_flush();
     }
 }
 
@@ -164,12 +407,87 @@ inline bool pal_is_fading(void)
     return pal_fading;
 }
 
+bool pal_cycle_set(const uint16_t id, const uint16_t index,
+                   const uint16_t count, const uint16_t speed,
+                   const bool reverse)
+{
+    pal_cycle_t *cycle;
+
+    if (id >= PAL_CYCLE_SIZE || count < 2 || (index + count) > 64 ||
+        speed == 0 || speed > 255)
+    {
+        return false;
+    }
+
+    cycle = &pal_cycles[id];
+    if (!cycle->count)
+    {
+        ++pal_cycles_running;
+    }
+    cycle->index = index;
+    cycle->count = count;
+    cycle->speed = speed;
+    cycle->counter = 0;
+    cycle->reverse = reverse;
+    return true;
+}
+
+void pal_cycle_stop(const uint16_t id)
+{
+    if (id < PAL_CYCLE_SIZE && pal_cycles[id].count)
+    {
+        pal_cycles[id].count = 0;
+        --pal_cycles_running;
+    }
+}
+
+void pal_cycle_stop_all(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < PAL_CYCLE_SIZE; ++i)
+    {
+        pal_cycles[i].count = 0;
+    }
+    pal_cycles_running = 0;
+}
+
 void pal_update(void)
 {
-    if (pal_update_needed)
+    uint16_t line;
+    uint16_t count;
+    uint8_t dirty;
+
+    /* Avoids walking the cycle slots if there is nothing to rotate */
+    if (pal_cycles_running)
     {
-        pal_update_needed = false;
-        /* Transfer the whole primary color buffer to CRAM */
-        dma_cram_transfer_fast(pal_primary, 0, 64, 2);
+        pal_cycles_step();
+    }
+
+    if (!pal_dirty_lines)
+    {
+        return;
+    }
+
+    dirty = pal_dirty_lines;
+    pal_dirty_lines = 0;
+    line = 0;
+    while (dirty)
+    {
+        /* Skips the clean lines */
+        while (!(dirty & 0x01))
+        {
+            dirty >>= 1;
+            ++line;
+        }
+        /* Merges contiguous dirty lines in one single transfer */
+        count = 0;
+        while (dirty & 0x01)
+        {
+            dirty >>= 1;
+            ++count;
+        }
+        pal_lines_upload(line, count);
+        line += count;
     }
 }
@@ -18,6 +18,8 @@
  * Only even numbers can be used (i.e. 02468ACE).
  * There is no need to write an entire palette, you can write individual colors
  * too.
+ * Palette cycles let you rotate ranges of colors automatically (waterfalls,
+ * lava, glowing effects, etc.) without touching the tiles.
  *
  * More info:
  * https://www.plutiedev.com/tiles-and-palettes
@@ -42,6 +44,15 @@
 #define PAL_2_INDEX   32      /* Colors 32..47 */
 #define PAL_3_INDEX   48      /* Colors 48..64 */
 
+/* Table driven fade operations (see pal_fade_table) */
+typedef enum pal_fade_type
+{
+    PAL_FADE_FROM_BLACK = 0x00,     /* Black to the alternate buffer colors */
+    PAL_FADE_TO_BLACK   = 0x01,     /* Primary buffer colors to black */
+    PAL_FADE_FROM_WHITE = 0x02,     /* White to the alternate buffer colors */
+    PAL_FADE_TO_WHITE   = 0x03      /* Primary buffer colors to white */
+} pal_fade_type_t;
+
 /**
  * @brief Initialises the palette system
  * 
@@ -103,6 +114,20 @@ void pal_swap(void);
  */
 void pal_fade(const uint16_t speed);
 
+/**
+ * @brief Starts a table driven fade operation from or to black or white
+ * 
+ * Table driven fades use precalculated brightness tables of 9 levels per color
+ * component, so each step costs the same for every color with no branches.
+ * Fades from black or white go towards the alternate buffer colors. Fades to
+ * black or white start copying the primary buffer into the alternate one, so a
+ * later fade from black or white restores the original colors.
+ * 
+ * @param speed Speed in frames between color fade updates
+ * @param type Fade operation to perform
+ */
+void pal_fade_table(const uint16_t speed, const pal_fade_type_t type);
+
 /**
  * @brief Advances the current color fade operation one step
  * 
@@ -129,12 +154,54 @@ void pal_fade_wait(void);
  */
 bool pal_is_fading(void);
 
+/**
+ * @brief Sets up a palette cycle on a range of colors
+ * 
+ * A palette cycle rotates one position the colors in the range each speed
+ * frames. Both internal color buffers are rotated, so running fades keep
+ * their targets in sync with the cycle. Cycles are advanced automatically by
+ * pal_update.
+ * 
+ * @param id Palette cycle slot to set (0..PAL_CYCLE_SIZE - 1)
+ * @param index Position in the buffer were the color range starts (0..63)
+ * @param count Number of colors in the range (2..64)
+ * @param speed Speed in frames between color rotations (1..255)
+ * @param reverse False to rotate colors towards higher indexes, true to rotate
+ * them towards lower indexes
+ * @return True on success, false otherwise
+ * 
+ * @note Ranges of active cycles should not overlap.
+ */
+bool pal_cycle_set(const uint16_t id, const uint16_t index,
+                   const uint16_t count, const uint16_t speed,
+                   const bool reverse);
+
+/**
+ * @brief Stops a running palette cycle
+ * 
+ * The colors are left in their current rotation.
+ * 
+ * @param id Palette cycle slot to stop (0..PAL_CYCLE_SIZE - 1)
+ */
+void pal_cycle_stop(const uint16_t id);
+
+/**
+ * @brief Stops all the running palette cycles
+ * 
+ */
+void pal_cycle_stop_all(void);
+
 /**
  * @brief Updates internal status and upload the primary buffer to CRAM
  * 
- * @note This function updates CRAM, so you should call it every frame after
- * waiting for the vertical blank (see vid_vsync_wait) or whenever you need to
- * upload your palettes to CRAM.
+ * Running palette cycles are advanced here. Then, only the palette lines
+ * modified since the last update are uploaded.
+ * Contiguous modified lines are merged in one transfer which is pushed into
+ * the DMA queue (or done immediately if the queue is full).
+ * 
+ * @note This function updates CRAM through the DMA queue, so you should call
+ * it every frame after waiting for the vertical blank (see vid_vsync_wait) and
+ * before flushing the DMA queue (see dma_queue_flush).
  */
 void pal_update(void);
 
@@ -21,6 +21,12 @@ inline uint16_t plane_cell_config(const uint16_t tile_index,
            (h_flip << 11) | tile_index;
 }
 
+inline uint16_t plane_cell_shadow_set(const uint16_t cell, const bool shadow)
+{
+    /* Shadowed cells are the low priority ones */
+    return shadow ? (cell & ~(0x01 << 15)) : (cell | (0x01 << 15));
+}
+
 inline void plane_clear(const uint16_t plane)
 {
     dma_vram_fill(plane, VID_PLANE_TILES << 1, 0x00, 1);
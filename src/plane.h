@@ -49,6 +49,19 @@ uint16_t plane_cell_config(const uint16_t tile_index, const uint16_t palette,
                            const uint16_t h_flip, const uint16_t v_flip,
                            const uint16_t priority);
 
+/**
+ * @brief Sets how a plane cell is drawn in shadow/highlight mode
+ * 
+ * In shadow/highlight mode, the cell priority selects whether it is drawn
+ * normally (high priority) or shadowed (low priority, unless the other plane
+ * has a high priority cell in the same position).
+ * 
+ * @param cell Tile index or a full cell tile config
+ * @param shadow True to draw the cell shadowed, false to draw it normally
+ * @return uint16_t Plane cell with the shadow/highlight property configured
+ */
+uint16_t plane_cell_shadow_set(const uint16_t cell, const bool shadow);
+
 /**
  * @brief Clears an entire VDP plane
  * 
@@ -0,0 +1,156 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: pool.h
+ * Fixed size object pools
+ *
+ * A pool is a static array of slots for objects of the same type. Free slots
+ * are linked in an intrusive list stored in the slots themselves, so getting or
+ * releasing an object is O(1) without scanning the array. Live objects can be
+ * walked in memory order, which is the cheapest access pattern for the m68k.
+ * Pools are generated for each object type using the POOL_DEFINE macro:
+ *      POOL_DEFINE(bullet, bullet_t, 64)
+ *      static bullet_pool_t bullets;
+ *      bullet_t *b;
+ *
+ *      bullet_pool_init(&bullets);
+ *      b = bullet_pool_alloc(&bullets);
+ *      for (b = bullet_pool_first(&bullets); b; b = bullet_pool_next(&bullets, b))
+ *      {
+ *          ...
+ *      }
+ *      bullet_pool_free(&bullets, b);
+ * 
+ */
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Defines a pool type and its functions for an object type
+ * 
+ * It generates these types and functions:
+ *      name##_pool_t: Pool type holding up to size objects
+ *      void name##_pool_init(name##_pool_t *pool): Frees all the objects
+ *      type *name##_pool_alloc(name##_pool_t *pool): Gets a free object or NULL
+ *      void name##_pool_free(name##_pool_t *pool, type *object): Frees object,
+ *          objects already free are ignored
+ *      uint16_t name##_pool_count(const name##_pool_t *pool): Live objects
+ *      type *name##_pool_first(name##_pool_t *pool): First live object or NULL
+ *      type *name##_pool_next(name##_pool_t *pool, type *object): Next live
+ *          object in memory order or NULL
+ * 
+ * @param name Prefix used for the generated type and functions
+ * @param type Object type stored in the pool
+ * @param size Maximum number of objects in the pool (at least 1)
+ * 
+ * @note Allocated objects are not cleared.
+ */
+#define POOL_DEFINE(name, type, size)                                          \
+typedef struct name##_pool_slot                                                \
+{                                                                              \
+    /* Object must be the first field to cast objects to slots */             \
+    union                                                                      \
+    {                                                                          \
+        type object;                                                           \
+        struct name##_pool_slot *next_free;                                    \
+    } data;                                                                    \
+    bool live;                                                                 \
+} name##_pool_slot_t;                                                          \
+                                                                               \
+typedef struct name##_pool                                                     \
+{                                                                              \
+    name##_pool_slot_t slots[size];                                            \
+    name##_pool_slot_t *free_head;                                             \
+    uint16_t count;                                                            \
+} name##_pool_t;                                                               \
+                                                                               \
+_Static_assert((size) > 0, "pool " #name " must hold at least one object");    \
+                                                                               \
+static inline void name##_pool_init(name##_pool_t *pool)                      \
+{                                                                              \
+    name##_pool_slot_t *slot = pool->slots;                                    \
+    uint16_t i = (size) - 1;                                                   \
+                                                                               \
+    /* Links the free slots in memory order */                                 \
+    while (i)                                                                  \
+    {                                                                          \
+        slot->data.next_free = slot + 1;                                       \
+        slot->live = false;                                                    \
+        ++slot;                                                                \
+        --i;                                                                   \
+    }                                                                          \
+    slot->data.next_free = 0;                                                  \
+    slot->live = false;                                                        \
+    pool->free_head = pool->slots;                                             \
+    pool->count = 0;                                                           \
+}                                                                              \
+                                                                               \
+static inline type *name##_pool_alloc(name##_pool_t *pool)                    \
+{                                                                              \
+    name##_pool_slot_t *slot = pool->free_head;                                \
+                                                                               \
+    if (!slot)                                                                 \
+    {                                                                          \
+        return 0;                                                              \
+    }                                                                          \
+    pool->free_head = slot->data.next_free;                                    \
+    slot->live = true;                                                         \
+    ++pool->count;                                                             \
+    return &slot->data.object;                                                 \
+}                                                                              \
+                                                                               \
+static inline void name##_pool_free(name##_pool_t *pool, type *object)        \
+{                                                                              \
+    name##_pool_slot_t *slot = (name##_pool_slot_t *) object;                  \
+                                                                               \
+    /* A slot already free is left alone, freeing it again would link it       \
+     * twice in the free list */                                               \
+    if (!slot->live)                                                           \
+    {                                                                          \
+        return;                                                                \
+    }                                                                          \
+    slot->live = false;                                                        \
+    slot->data.next_free = pool->free_head;                                    \
+    pool->free_head = slot;                                                    \
+    --pool->count;                                                             \
+}                                                                              \
+                                                                               \
+static inline uint16_t name##_pool_count(const name##_pool_t *pool)           \
+{                                                                              \
+    return pool->count;                                                        \
+}                                                                              \
+                                                                               \
+static inline type *name##_pool_scan(name##_pool_t *pool,                     \
+                                     name##_pool_slot_t *slot)                 \
+{                                                                              \
+    const name##_pool_slot_t *end = pool->slots + (size);                      \
+                                                                               \
+    while (slot < end)                                                         \
+    {                                                                          \
+        if (slot->live)                                                        \
+        {                                                                      \
+            return &slot->data.object;                                         \
+        }                                                                      \
+        ++slot;                                                                \
+    }                                                                          \
+    return 0;                                                                  \
+}                                                                              \
+                                                                               \
+static inline type *name##_pool_first(name##_pool_t *pool)                    \
+{                                                                              \
+    return name##_pool_scan(pool, pool->slots);                                \
+}                                                                              \
+                                                                               \
+static inline type *name##_pool_next(name##_pool_t *pool, type *object)       \
+{                                                                              \
+    return name##_pool_scan(pool, ((name##_pool_slot_t *) object) + 1);        \
+}
+
+#endif /* POOL_H */
@@ -9,11 +9,49 @@
  */
 
 #include <stdint.h>
+#include <stddef.h>
 #include "psg.h"
+#include "config.h"
+#include "sys.h"
 
 /* PSG port from the m68k side */
 #define PSG_PORT ((volatile uint8_t *) 0xC00011)
 
+/* PSG channels */
+#define PSG_CHANNELS        4
+#define PSG_NOISE_CHANNEL   3
+
+/* Sfx commands, found where a step would have its frames byte at 0 */
+#define PSG_SFX_CMD_END     0x00
+#define PSG_SFX_CMD_PERIOD  0x01
+
+/* Sfx channel state */
+typedef struct psg_sfx_channel_t
+{
+    const uint8_t *data;    /* Next sfx byte, NULL if the channel is free */
+    uint16_t period;        /* Current tone period or noise mode */
+    uint16_t age;           /* Start order, used to steal the oldest one */
+    int8_t slide;           /* Tone period increment each frame */
+    int8_t volume_step;     /* Attenuation increment each frame */
+    int8_t volume;          /* Current attenuation */
+    uint8_t frames;         /* Frames left in the current step */
+    uint8_t priority;       /* Sfx priority */
+    uint8_t out_volume;     /* Attenuation to write in this frame */
+    uint16_t out_period;    /* Period to write in this frame */
+} psg_sfx_channel_t;
+
+static psg_sfx_channel_t psg_sfx_channels[PSG_CHANNELS];
+/* Channels the sfx can use */
+static uint8_t psg_sfx_mask;
+/* Channels to write in this frame (bit n = channel n) */
+static uint8_t psg_sfx_out_mask;
+/* Channels to silence because their sfx stopped */
+static volatile uint8_t psg_sfx_silence_mask;
+/* Last noise mode written, 0xFF to force the next write */
+static uint8_t psg_sfx_noise_mode;
+/* Sfx start counter */
+static uint16_t psg_sfx_age;
+
 void psg_init(void)
 {
     uint16_t i;
@@ -31,4 +69,249 @@ void psg_init(void)
         *PSG_PORT = 0x80 | (i << 5) | 0x00;
         *PSG_PORT = 0x00;
     }
-}
\ No newline at end of file
+
+    for (i = 0; i < PSG_CHANNELS; ++i)
+    {
+        psg_sfx_channels[i].data = NULL;
+    }
+    psg_sfx_mask = PSG_SFX_CHANNELS;
+    psg_sfx_out_mask = 0;
+    psg_sfx_silence_mask = 0;
+    psg_sfx_noise_mode = 0xFF;
+    psg_sfx_age = 0;
+}
+
+void psg_sfx_channels_set(const uint8_t mask)
+{
+    uint8_t i;
+
+    psg_sfx_mask = mask;
+    for (i = 0; i < PSG_CHANNELS; ++i)
+    {
+        if (!(mask & (1 << i)))
+        {
+            psg_sfx_stop(i);
+        }
+    }
+}
+
+inline uint8_t psg_sfx_channels_get(void)
+{
+    return psg_sfx_mask;
+}
+
+int8_t psg_sfx_play(const uint8_t *sfx, const uint8_t priority)
+{
+    psg_sfx_channel_t *channel;
+    psg_sfx_channel_t *victim;
+    uint8_t first;
+    uint8_t last;
+    uint8_t i;
+
+    /* Tone sfx can use channels 0..2, noise sfx only channel 3 */
+    if (sfx[0] == PSG_SFX_NOISE)
+    {
+        first = PSG_NOISE_CHANNEL;
+        last = PSG_NOISE_CHANNEL;
+    }
+    else
+    {
+        first = 0;
+        last = PSG_NOISE_CHANNEL - 1;
+    }
+
+    /* A free channel or the one with the lowest priority and oldest sfx */
+    victim = NULL;
+    for (i = first; i <= last; ++i)
+    {
+        if (!(psg_sfx_mask & (1 << i)))
+        {
+            continue;
+        }
+        channel = &psg_sfx_channels[i];
+        if (channel->data == NULL)
+        {
+            victim = channel;
+            break;
+        }
+        if (channel->priority <= priority &&
+            (victim == NULL || channel->priority < victim->priority ||
+             (channel->priority == victim->priority &&
+              (uint16_t) (psg_sfx_age - channel->age) >
+              (uint16_t) (psg_sfx_age - victim->age))))
+        {
+            victim = channel;
+        }
+    }
+    if (victim == NULL)
+    {
+        return -1;
+    }
+
+    /* Don't let psg_sfx_update see a half initialised channel */
+    smd_ints_disable();
+    victim->data = sfx + 1;
+    victim->period = 0;
+    victim->frames = 0;
+    victim->priority = priority;
+    victim->age = psg_sfx_age++;
+    if (victim == &psg_sfx_channels[PSG_NOISE_CHANNEL])
+    {
+        psg_sfx_noise_mode = 0xFF;
+    }
+    smd_ints_enable();
+
+    return victim - psg_sfx_channels;
+}
+
+void psg_sfx_stop(const uint8_t channel)
+{
+    smd_ints_disable();
+    if (psg_sfx_channels[channel].data)
+    {
+        psg_sfx_channels[channel].data = NULL;
+        psg_sfx_out_mask &= ~(1 << channel);
+        psg_sfx_silence_mask |= 1 << channel;
+    }
+    smd_ints_enable();
+}
+
+void psg_sfx_stop_all(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < PSG_CHANNELS; ++i)
+    {
+        psg_sfx_stop(i);
+    }
+}
+
+inline bool psg_sfx_is_playing(const uint8_t channel)
+{
+    return psg_sfx_channels[channel].data != NULL;
+}
+
+/**
+ * @brief Reads the sfx commands up to the next step
+ *
+ * @param channel Sfx channel
+ * @return true if a new step was loaded, false if the sfx ended
+ */
+static bool psg_sfx_step_next(psg_sfx_channel_t *channel)
+{
+    const uint8_t *data = channel->data;
+
+    while (data[0] == 0)
+    {
+        if (data[1] == PSG_SFX_CMD_PERIOD)
+        {
+            channel->period = (data[2] << 8) | data[3];
+            data += 4;
+        }
+        else
+        {
+            /* PSG_SFX_CMD_END or unknown command */
+            return false;
+        }
+    }
+
+    channel->frames = data[0];
+    channel->volume = data[1] & 0x0F;
+    /* Sign extends the attenuation step nibble */
+    channel->volume_step = ((int8_t) data[1]) >> 4;
+    channel->slide = (int8_t) data[2];
+    channel->data = data + 3;
+
+    return true;
+}
+
+void psg_sfx_update(void)
+{
+    psg_sfx_channel_t *channel;
+    uint8_t mask;
+    uint8_t i;
+    int16_t value;
+
+    mask = 0;
+    channel = psg_sfx_channels;
+    for (i = 0; i < PSG_CHANNELS; ++i, ++channel)
+    {
+        if (channel->data == NULL)
+        {
+            continue;
+        }
+
+        if (channel->frames == 0 && !psg_sfx_step_next(channel))
+        {
+            channel->data = NULL;
+            psg_sfx_silence_mask |= 1 << i;
+            continue;
+        }
+
+        /* State written by psg_sfx_commit in this frame */
+        channel->out_period = channel->period;
+        channel->out_volume = channel->volume;
+        mask |= 1 << i;
+
+        /* Envelope and pitch slide for the next frame */
+        value = channel->volume + channel->volume_step;
+        channel->volume = value < 0 ? 0 : (value > 15 ? 15 : value);
+        if (i != PSG_NOISE_CHANNEL)
+        {
+            value = channel->period + channel->slide;
+            channel->period = value < 1 ? 1 : (value > 1023 ? 1023 : value);
+        }
+        --channel->frames;
+    }
+    psg_sfx_out_mask = mask;
+}
+
+void psg_sfx_commit(void)
+{
+    psg_sfx_channel_t *channel;
+    uint8_t mask;
+    uint8_t latch;
+    uint8_t i;
+
+    /* Silence the channels whose sfx stopped */
+    mask = psg_sfx_silence_mask;
+    psg_sfx_silence_mask = 0;
+    for (i = 0; i < PSG_CHANNELS; ++i)
+    {
+        if (mask & (1 << i))
+        {
+            *PSG_PORT = 0x90 | (i << 5) | 0x0F;
+        }
+    }
+
+    /*
+     * Writes the whole state of the running sfx each frame, so the channel is
+     * restored even if something else wrote it
+     */
+    mask = psg_sfx_out_mask;
+    channel = psg_sfx_channels;
+    for (i = 0; i < PSG_CHANNELS; ++i, ++channel)
+    {
+        if (!(mask & (1 << i)))
+        {
+            continue;
+        }
+        latch = i << 5;
+
+        if (i == PSG_NOISE_CHANNEL)
+        {
+            /* Writing the noise mode resets the noise generator */
+            if (channel->out_period != psg_sfx_noise_mode)
+            {
+                psg_sfx_noise_mode = channel->out_period;
+                *PSG_PORT = 0xE0 | (channel->out_period & 0x07);
+            }
+        }
+        else
+        {
+            *PSG_PORT = 0x80 | latch | (channel->out_period & 0x0F);
+            *PSG_PORT = (channel->out_period >> 4) & 0x3F;
+        }
+        *PSG_PORT = 0x90 | latch | channel->out_volume;
+    }
+}
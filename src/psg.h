@@ -12,6 +12,37 @@
  * wave generators) and the last one is a noise genrator. Each channel has its
  * own volume control.
  *
+ * It also includes a small sfx sequencer which runs on the m68k from the vblank
+ * interrupt and writes the PSG port directly inside the sound_update z80 bus
+ * request, so simple sounds don't need any extra one. Sfx are byte arrays built
+ * with the PSG_SFX macros:
+ *  - A header byte: PSG_SFX_TONE (plays on a tone channel) or PSG_SFX_NOISE.
+ *  - PSG_SFX_PERIOD(p): Sets the tone period [1..1023] (or the noise mode).
+ *  - PSG_SFX_STEP(frames, attenuation, attenuation step, slide): Plays for a
+ *    number of frames [1..255] from an attenuation [0 loud..15 silent], adding
+ *    the attenuation step [-8..7] (envelope) and the slide [-128..127] to the
+ *    tone period (pitch slide) each frame.
+ *  - PSG_SFX_END: Ends the sfx and silences the channel.
+ *
+ * Usage example:
+ *  const uint8_t sfx_jump[] = {
+ *      PSG_SFX_TONE,
+ *      PSG_SFX_PERIOD(400),
+ *      PSG_SFX_STEP(12, 2, 0, -20),
+ *      PSG_SFX_STEP(6, 2, 2, -20),
+ *      PSG_SFX_END
+ *  };
+ *  psg_sfx_play(sfx_jump, 5);
+ *
+ * The XGM music also writes the PSG and it doesn't know about the sfx, so the
+ * sfx channels (psg_sfx_channels_set, PSG_SFX_CHANNELS in config.h by default)
+ * must never be used by the songs. The whole state of the running sfx is
+ * written each frame, so a song using them would only be heard as glitches.
+ * The XGM driver is told about these channels each frame and leaves them
+ * untouched when it restores the PSG volumes (level changes, fades, resume).
+ * The writes are done while the z80 is stopped and never in the middle of its
+ * own PSG tone writes, so the latch and data bytes of both are never mixed.
+ *
  * More info:
  * https://www.plutiedev.com/psg
  * https://blog.bigevilcorporation.co.uk/2012/09/03/sega-megadrive-10-sound-part-i-the-psg-chip/
@@ -20,6 +51,30 @@
 #ifndef PSG_H
 #define PSG_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Sfx header types */
+#define PSG_SFX_TONE    0
+#define PSG_SFX_NOISE   1
+
+/* Noise modes for PSG_SFX_PERIOD in noise sfx */
+#define PSG_NOISE_PERIODIC_HIGH     0x00
+#define PSG_NOISE_PERIODIC_MED      0x01
+#define PSG_NOISE_PERIODIC_LOW      0x02
+#define PSG_NOISE_PERIODIC_TONE2    0x03
+#define PSG_NOISE_WHITE_HIGH        0x04
+#define PSG_NOISE_WHITE_MED         0x05
+#define PSG_NOISE_WHITE_LOW         0x06
+#define PSG_NOISE_WHITE_TONE2       0x07
+
+/* Sfx data building macros */
+#define PSG_SFX_END         0x00, 0x00
+#define PSG_SFX_PERIOD(p)   0x00, 0x01, (((p) >> 8) & 0x03), ((p) & 0xFF)
+#define PSG_SFX_STEP(frames, att, att_step, slide) \
+    ((frames) & 0xFF), ((((att_step) & 0x0F) << 4) | ((att) & 0x0F)), \
+    ((slide) & 0xFF)
+
 /**
  * @brief initialises the PSG sound hardware.
  * 
@@ -31,4 +86,75 @@
  */
 void psg_init(void);
 
+/**
+ * @brief Sets the channels the sfx sequencer can use
+ * 
+ * Running sfx on channels which are not allowed anymore are stopped.
+ * 
+ * @param mask Allowed channels (bit n = channel n, channel 3 is the noise)
+ */
+void psg_sfx_channels_set(const uint8_t mask);
+
+/**
+ * @brief Gets the channels the sfx sequencer can use
+ * 
+ * @return uint8_t Allowed channels (bit n = channel n, channel 3 is the noise)
+ */
+uint8_t psg_sfx_channels_get(void);
+
+/**
+ * @brief Starts playing a PSG sfx
+ * 
+ * Uses a free allowed channel of the sfx type. If there is none, it steals the
+ * channel of the running sfx with the lowest priority, if it is not higher
+ * than this one (on ties, the one started first).
+ * 
+ * @param sfx Sfx data
+ * @param priority Playing priority ranging from 0 (lowest) to 255 highest
+ * @return int8_t Channel used or -1 if the sfx couldn't be played
+ */
+int8_t psg_sfx_play(const uint8_t *sfx, const uint8_t priority);
+
+/**
+ * @brief Stops the sfx running on a channel and silences it
+ * 
+ * @param channel PSG channel [0..3]
+ */
+void psg_sfx_stop(const uint8_t channel);
+
+/**
+ * @brief Stops all the running sfx
+ */
+void psg_sfx_stop_all(void);
+
+/**
+ * @brief Checks whether a sfx is running on a channel
+ * 
+ * @param channel PSG channel [0..3]
+ * @return True if a sfx is running, false otherwise
+ */
+bool psg_sfx_is_playing(const uint8_t channel);
+
+/**
+ * @brief Updates the running sfx
+ * 
+ * Advances the sfx one frame and prepares the PSG state psg_sfx_commit writes.
+ * 
+ * @note This function is called automatically in the vint before sound_update,
+ * so you don't need to call it.
+ */
+void psg_sfx_update(void);
+
+/**
+ * @brief Writes the running sfx state to the PSG
+ * 
+ * Silences the channels of the stopped sfx and writes the tone period (or
+ * noise mode) and the attenuation of the running ones.
+ * 
+ * @note This function is called automatically by sound_update while it holds
+ * the z80 bus and the XGM driver is not writing the PSG, so you don't need to
+ * call it.
+ */
+void psg_sfx_commit(void);
+
 #endif /* PSG_H */
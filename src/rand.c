@@ -13,6 +13,8 @@
 
 /* Stores the lastest (current) calculated seed */
 static uint16_t rnd_seed;
+/* Stores the lastest calculated seed of the 32 bits generator */
+static uint32_t rnd32_seed;
 
 void rnd_init(void)
 {
@@ -22,6 +24,14 @@ void rnd_init(void)
     rnd_var = (uint16_t) 0xCE52 ^ (uint16_t) (0xCE52 << 9);
     rnd_seed = *VDP_PORT_HV_COUNTER ^ (*VDP_PORT_HV_COUNTER >> 7);
     rnd_seed = rnd_seed ^ rnd_var ^ (rnd_var << 13);
+    /* Seeds can't be 0 or the generators would get stuck */
+    if (rnd_seed == 0)
+    {
+        rnd_seed = 0xCE52;
+    }
+
+    /* The 32 bits generator starts from the 16 bits one */
+    rnd32_seed = ((uint32_t) rnd_seed << 16) | (uint16_t) ~rnd_seed;
 }
 
 void rnd_seed_set(const uint16_t seed)
@@ -48,3 +58,62 @@ uint16_t rnd_get(void)
 
     return rnd_seed;
 }
+
+void rnd_fill(uint16_t *buffer, const uint16_t n)
+{
+    uint16_t seed;
+    uint16_t i;
+
+    /* Work on a local copy, so it can live in a register */
+    seed = rnd_seed;
+    for (i = n; i; --i)
+    {
+        seed ^= seed << 7;
+        seed ^= seed >> 9;
+        seed ^= seed << 8;
+        *buffer++ = seed;
+    }
+    rnd_seed = seed;
+}
+
+uint16_t rnd_range(const uint16_t n)
+{
+    uint32_t value;
+    uint16_t threshold;
+
+    /* The high word of rnd * n is in [0, n) */
+    value = (uint32_t) rnd_get() * n;
+
+    /* Reject values from the uneven part of the 65536 / n slices (Lemire) */
+    if ((uint16_t) value < n)
+    {
+        threshold = (uint16_t) (0x10000 - n) % n;
+        while ((uint16_t) value < threshold)
+        {
+            value = (uint32_t) rnd_get() * n;
+        }
+    }
+
+    return (uint16_t) (value >> 16);
+}
+
+void rnd32_seed_set(const uint32_t seed)
+{
+    /* seed must be a non-zero value */
+    if (seed == 0)
+    {
+        rnd_init();
+        return;
+    }
+    rnd32_seed = seed;
+}
+
+uint32_t rnd32_get(void)
+{
+    /* Xorshift32 algorithm */
+    rnd32_seed ^= rnd32_seed << 13;
+    rnd32_seed ^= rnd32_seed >> 17;
+    rnd32_seed ^= rnd32_seed << 5;
+
+    return rnd32_seed;
+}
@@ -10,8 +10,12 @@
  * Implementation of pseudo-random number generation using Xorshift algorithm
  * by George Marsaglia
  *
+ * A second 32 bits xorshift generator is available (rnd32_*) when the period
+ * of the 16 bits one (65535 numbers) is too short.
+ *
  * More info:
  * http://www.retroprogramming.com/2017/07/xorshift-pseudorandom-numbers-in-z80.html
+ * https://lemire.me/blog/2016/06/30/fast-random-shuffling/
  */
 
 #ifndef RAND_H
@@ -57,4 +61,47 @@ uint16_t rnd_seed_get(void);
  */
 uint16_t rnd_get(void);
 
+/**
+ * @brief Fills a buffer with random numbers
+ * 
+ * Generates n new pseudo-random numbers in one go. It keeps the generator
+ * state in registers, so it is much faster than calling rnd_get n times.
+ * 
+ * @param buffer Destination buffer
+ * @param n Number of values to generate
+ */
+void rnd_fill(uint16_t *buffer, const uint16_t n);
+
+/**
+ * @brief Generates a new random number in a range
+ * 
+ * Returns a new pseudo-random number in the range [0, n). The number is mapped
+ * to the range with a multiplication instead of a modulo (slow DIVU), and it
+ * is unbiased as values which would favour part of the range are rejected.
+ * 
+ * @param n Range size, must be greater than 0
+ * @return uint16_t The new number
+ * 
+ * @note Rejections are rare (probability n/65536), so it takes a single MULU
+ * in most calls
+ */
+uint16_t rnd_range(const uint16_t n);
+
+/**
+ * @brief Sets a new seed for the 32 bits prng
+ * 
+ * @param seed  New seed, if it is 0 a random seed will be used
+ */
+void rnd32_seed_set(const uint32_t seed);
+
+/**
+ * @brief Generates a new 32 bits random number
+ * 
+ * Uses a 32 bits xorshift generator with a period of 2^32 - 1 numbers. It is
+ * slower than rnd_get, so use it only when the longer period is needed.
+ * 
+ * @return uint32_t The new number
+ */
+uint32_t rnd32_get(void);
+
 #endif /* RAND_H */
\ No newline at end of file
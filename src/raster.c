@@ -0,0 +1,302 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: raster.c
+ * Raster effects scheduler using the horizontal blank interrupt
+ */
+
+#include "raster.h"
+#include "config.h"
+#include "vdp.h"
+#include "sys.h"
+
+/*
+ * Operation codes of the compiled raster program. Each group of operations
+ * starts with the HBlank counter register write for the next gap and ends with
+ * RASTER_OP_END:
+ *      RASTER_OP_CTRL: word written to the control port
+ *      RASTER_OP_DATA: long written to the control port, word to the data port
+ *      RASTER_OP_CALL: long callback address
+ * These values are also used by the HBlank handler in interrupts.s.
+ */
+#define RASTER_OP_END   0
+#define RASTER_OP_CTRL  1
+#define RASTER_OP_DATA  2
+#define RASTER_OP_CALL  3
+
+/* Program size in words: two fixed groups plus one group per operation */
+#define RASTER_PROGRAM_SIZE (((RASTER_SIZE + 2) * 2) + (RASTER_SIZE * 4))
+
+/* Mode register 1 values with the HBlank interrupt on and off */
+#define RASTER_HINT_ON      (VDP_REG_MODESET_1 | 0x14)
+#define RASTER_HINT_OFF     (VDP_REG_MODESET_1 | 0x04)
+
+/* Active display height in scanlines, V30 in pal and V28 in ntsc */
+#define RASTER_HEIGHT_PAL   240
+#define RASTER_HEIGHT_NTSC  224
+
+/* Defines a raster operation in the list */
+typedef struct raster_op
+{
+    uint16_t line;      /* Scanline */
+    uint16_t code;      /* Operation code */
+    uint32_t ctrl;      /* Control port command or callback address */
+    uint16_t data;      /* Data port word */
+} raster_op_t;
+
+/* Raster operations list sorted by scanline and its size */
+static raster_op_t raster_ops[RASTER_SIZE];
+static uint16_t raster_ops_size;
+
+/* Compiled programs. One is running while the other one is being built */
+static uint16_t raster_programs[2][RASTER_PROGRAM_SIZE];
+/* Running program, NULL if there are no raster effects */
+static const uint16_t *volatile raster_program;
+/* Program committed to start running in the next frame */
+static const uint16_t *volatile raster_program_pending;
+/* Is there a new committed program? */
+static volatile bool raster_commit_pending;
+/* Is the HBlank interrupt enabled in the VDP now? */
+static bool raster_hint_enabled;
+
+/* Next group of operations to run by the HBlank handler */
+const uint16_t *raster_cursor;
+
+/**
+ * @brief Inserts a new operation in the list keeping it sorted by scanline
+ * 
+ * Operations in the same scanline keep the order in which they were added.
+ * 
+ * @param line Scanline where the operation runs
+ * @param code Operation code
+ * @param ctrl Control port command or callback address
+ * @param data Data port word
+ * @return True on success, false if the list is full or the scanline is out of
+ * the active display
+ */
+static bool raster_op_insert(const uint16_t line, const uint16_t code,
+                             const uint32_t ctrl, const uint16_t data)
+{
+    uint16_t i;
+
+    if (raster_ops_size >= RASTER_SIZE)
+    {
+        return false;
+    }
+    /* The last interrupt must be raised before the vblank resets the cursor */
+    if (line >= (smd_is_pal() ? RASTER_HEIGHT_PAL : RASTER_HEIGHT_NTSC))
+    {
+        return false;
+    }
+
+    /* Moves up the operations in later scanlines */
+    i = raster_ops_size;
+    while (i && raster_ops[i - 1].line > line)
+    {
+        raster_ops[i] = raster_ops[i - 1];
+        --i;
+    }
+    raster_ops[i].line = line;
+    raster_ops[i].code = code;
+    raster_ops[i].ctrl = ctrl;
+    raster_ops[i].data = data;
+    ++raster_ops_size;
+    return true;
+}
+
+/**
+ * @brief Builds a VDP ctrl port write address command
+ * 
+ * @param xram_addr VRAM/CRAM/VSRAM address base command
+ * @param dest Destination ram address
+ * @return uint32_t Ctrl port write address command
+ */
+static inline uint32_t raster_ctrl_addr_build(const uint32_t xram_addr,
+                                              const uint32_t dest)
+{
+    return (((uint32_t)(xram_addr)) | (((uint32_t)(dest) & 0x3FFF) << 16) |
+            ((uint32_t)(dest) >> 14));
+}
+
+void raster_init(void)
+{
+    raster_ops_size = 0;
+    raster_program = 0;
+    raster_program_pending = 0;
+    raster_commit_pending = false;
+    raster_cursor = 0;
+    raster_hint_enabled = false;
+    *VDP_PORT_CTRL_W = RASTER_HINT_OFF;
+}
+
+inline void raster_clear(void)
+{
+    raster_ops_size = 0;
+}
+
+bool raster_reg_write(const uint16_t line, const uint16_t reg,
+                      const uint8_t value)
+{
+    return raster_op_insert(line, RASTER_OP_CTRL, 0x8000 | (reg << 8) | value,
+                            0);
+}
+
+bool raster_cram_write(const uint16_t line, const uint16_t index,
+                       const uint16_t color)
+{
+    return raster_op_insert(line, RASTER_OP_DATA,
+                            raster_ctrl_addr_build(VDP_CRAM_WRITE_CMD,
+                                                   index << 1), color);
+}
+
+bool raster_vsram_write(const uint16_t line, const uint16_t dest,
+                        const uint16_t value)
+{
+    return raster_op_insert(line, RASTER_OP_DATA,
+                            raster_ctrl_addr_build(VDP_VSRAM_WRITE_CMD, dest),
+                            value);
+}
+
+bool raster_vram_write(const uint16_t line, const uint16_t dest,
+                       const uint16_t value)
+{
+    return raster_op_insert(line, RASTER_OP_DATA,
+                            raster_ctrl_addr_build(VDP_VRAM_WRITE_CMD, dest),
+                            value);
+}
+
+bool raster_call(const uint16_t line, const raster_callback_t callback)
+{
+    return raster_op_insert(line, RASTER_OP_CALL, (uint32_t) callback, 0);
+}
+
+void raster_commit(void)
+{
+    /* Interrupt scanlines, two fixed ones plus one per operation */
+    uint16_t lines[RASTER_SIZE + 2];
+    uint16_t lines_size;
+    const uint16_t *running;
+    uint16_t *program;
+    const raster_op_t *op;
+    uint16_t i;
+    uint16_t j;
+
+    /*
+     * Keeps the vblank from taking a half built program. The running program
+     * is read before clearing the flag, so a vblank between them can not swap
+     * in the buffer we are going to build
+     */
+    running = raster_program;
+    raster_commit_pending = false;
+
+    if (!raster_ops_size)
+    {
+        raster_program_pending = 0;
+        raster_commit_pending = true;
+        return;
+    }
+
+    /* Builds the program in the buffer which is not running */
+    program = raster_programs[running == raster_programs[0] ? 1 : 0];
+    raster_program_pending = program;
+
+    /* Scanlines 0 and 1 are always used to program the first gaps */
+    lines[0] = 0;
+    lines[1] = 1;
+    lines_size = 2;
+    for (i = 0; i < raster_ops_size; ++i)
+    {
+        if (raster_ops[i].line > lines[lines_size - 1])
+        {
+            lines[lines_size] = raster_ops[i].line;
+            ++lines_size;
+        }
+    }
+
+    /*
+     * The HBlank counter is reloaded when its interrupt is raised, before we
+     * can change it, so each group programs the gap after the next scanline.
+     * The last but one group sets the maximum gap, so no more interrupts are
+     * raised in this frame. The last group sets a 0 gap which the counter
+     * takes on the vblank lines, so the next frame starts again in scanline 0
+     * without touching the VDP in the vblank handler.
+     */
+    op = raster_ops;
+    j = 0;
+    for (i = 0; i < lines_size; ++i)
+    {
+        if (i + 2 < lines_size)
+        {
+            *program++ = VDP_REG_HBLANK_RATE | (lines[i + 2] - lines[i + 1] - 1);
+        }
+        else if (i + 1 < lines_size)
+        {
+            *program++ = VDP_REG_HBLANK_RATE | 0xFF;
+        }
+        else
+        {
+            *program++ = VDP_REG_HBLANK_RATE | 0x00;
+        }
+        /* Operations of this scanline */
+        while (j < raster_ops_size && op->line == lines[i])
+        {
+            *program++ = op->code;
+            switch (op->code)
+            {
+            case RASTER_OP_CTRL:
+                *program++ = op->ctrl;
+                break;
+            case RASTER_OP_DATA:
+                *program++ = op->ctrl >> 16;
+                *program++ = op->ctrl;
+                *program++ = op->data;
+                break;
+            case RASTER_OP_CALL:
+                *program++ = op->ctrl >> 16;
+                *program++ = op->ctrl;
+                break;
+            }
+            ++op;
+            ++j;
+        }
+        *program++ = RASTER_OP_END;
+    }
+
+    raster_commit_pending = true;
+}
+
+void raster_update(void)
+{
+    if (raster_commit_pending)
+    {
+        raster_commit_pending = false;
+        raster_program = raster_program_pending;
+    }
+
+    /*
+     * VDP registers are only written when the raster effects start or stop, so
+     * a lag frame never touches the control port in the middle of a main code
+     * command. While a program is running, its last group leaves the HBlank
+     * counter ready for scanline 0 of the next frame.
+     */
+    if (raster_program)
+    {
+        raster_cursor = raster_program;
+        if (!raster_hint_enabled)
+        {
+            /* The counter is reloaded on each vblank line, it will be 0 */
+            *VDP_PORT_CTRL_W = VDP_REG_HBLANK_RATE | 0x00;
+            *VDP_PORT_CTRL_W = RASTER_HINT_ON;
+            raster_hint_enabled = true;
+        }
+    }
+    else if (raster_hint_enabled)
+    {
+        *VDP_PORT_CTRL_W = RASTER_HINT_OFF;
+        *VDP_PORT_CTRL_W = VDP_REG_HBLANK_RATE | 0xFF;
+        raster_hint_enabled = false;
+    }
+}
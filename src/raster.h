@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: raster.h
+ * Raster effects scheduler using the horizontal blank interrupt
+ *
+ * The VDP can raise an interrupt in the horizontal blank of the scanlines
+ * selected by its HBlank counter register. Changing VDP registers, colors or
+ * scroll values in these interrupts lets us show more than 64 colors on screen,
+ * split the screen in different scroll zones, etc.
+ * This scheduler keeps a list of raster operations sorted by scanline. Once the
+ * list is committed, it is compiled to a compact program which the HBlank
+ * interrupt handler runs each frame, reprogramming the HBlank counter between
+ * scanlines.
+ * The HBlank counter reload is applied one interrupt late, so the scheduler
+ * always adds two short interrupts at scanlines 0 and 1 to program the first
+ * gaps. Operations in the same scanline are run in the same interrupt.
+ * Be aware that raster operations use the VDP control port, so the main code
+ * should not access the VDP during the active display while they are running.
+ *
+ * More info:
+ * https://www.plutiedev.com/vdp-registers#reg10
+ * https://segaretro.org/Sega_Mega_Drive/Interrupts
+ */
+
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Raster callback function called in the HBlank of its scanline */
+typedef void (*raster_callback_t)(void);
+
+/**
+ * @brief Initialises the raster effects scheduler
+ * 
+ * Clears the operation list and disables the HBlank interrupt.
+ * 
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void raster_init(void);
+
+/**
+ * @brief Clears the operation list
+ * 
+ * The running raster effects are not changed until raster_commit is called.
+ */
+void raster_clear(void);
+
+/**
+ * @brief Adds a VDP register write to the operation list
+ * 
+ * @param line Scanline where the register is written (0..223, 0..239 pal)
+ * @param reg VDP register number (0..23)
+ * @param value New register value
+ * @return True on success, false if the list is full or the line is out of
+ * the active display
+ */
+bool raster_reg_write(const uint16_t line, const uint16_t reg,
+                      const uint8_t value);
+
+/**
+ * @brief Adds a color write in CRAM to the operation list
+ * 
+ * @param line Scanline where the color is written (0..223, 0..239 pal)
+ * @param index Color index in CRAM (0..63)
+ * @param color New color value in 0x0BGR format
+ * @return True on success, false if the list is full or the line is out of
+ * the active display
+ * 
+ * @note Writing CRAM during the active display could show some dots in the
+ * screen borders.
+ */
+bool raster_cram_write(const uint16_t line, const uint16_t index,
+                       const uint16_t color);
+
+/**
+ * @brief Adds a word write in VSRAM to the operation list
+ * 
+ * @param line Scanline where the word is written (0..223, 0..239 pal)
+ * @param dest VSRAM address (0 is plane A vertical scroll, 2 is plane B)
+ * @param value New vertical scroll value
+ * @return True on success, false if the list is full or the line is out of
+ * the active display
+ */
+bool raster_vsram_write(const uint16_t line, const uint16_t dest,
+                        const uint16_t value);
+
+/**
+ * @brief Adds a word write in VRAM to the operation list
+ * 
+ * It can be used to change horizontal scroll values in the HScroll table.
+ * 
+ * @param line Scanline where the word is written (0..223, 0..239 pal)
+ * @param dest VRAM address
+ * @param value New word value
+ * @return True on success, false if the list is full or the line is out of
+ * the active display
+ */
+bool raster_vram_write(const uint16_t line, const uint16_t dest,
+                       const uint16_t value);
+
+/**
+ * @brief Adds a callback call to the operation list
+ * 
+ * @param line Scanline where the callback is called (0..223, 0..239 pal)
+ * @param callback Function to call
+ * @return True on success, false if the list is full or the line is out of
+ * the active display
+ * 
+ * @note Callbacks run inside the HBlank interrupt. Keep them really short or
+ * their changes will be visible in the next scanlines.
+ */
+bool raster_call(const uint16_t line, const raster_callback_t callback);
+
+/**
+ * @brief Compiles the operation list and schedules it
+ * 
+ * The compiled operations start running in the next frame and keep running
+ * each frame until a new list is committed. Committing an empty list stops the
+ * raster effects and disables the HBlank interrupt.
+ */
+void raster_commit(void);
+
+/**
+ * @brief Prepares the scheduled raster operations for the next frame
+ * 
+ * @note This function is called automatically in the vint so you don't need to
+ * call it.
+ */
+void raster_update(void);
+
+#endif /* RASTER_H */
@@ -11,7 +11,10 @@
 #include <stdint.h>
 #include "sound.h"
 #include "sys.h"
+#include "vdp.h"
+#include "config.h"
 #include "z80.h"
+#include "psg.h"
 #include "null_data.h"
 #include "z80_xgm.h"
 
@@ -60,6 +63,33 @@
 /* XGM parameters data address */
 #define XGM_PARAMS_ADDR ((volatile uint8_t *) 0xA00104)
 
+/*
+ * XGM music volume and fade parameters:
+ * XGM_PARAMS_ADDR + 0x93 = Level arguments update flag
+ * XGM_PARAMS_ADDR + 0x94 = Fade arguments update flag
+ * XGM_PARAMS_ADDR + 0x95 = Fade running ($FF) or done ($00)
+ * XGM_PARAMS_ADDR + 0x97 = FM attenuation
+ * XGM_PARAMS_ADDR + 0x98 = PSG attenuation
+ * XGM_PARAMS_ADDR + 0x99 = Fade target attenuation
+ * XGM_PARAMS_ADDR + 0x9A = Fade step per XGM frame (z80 little endian 8.8)
+ * XGM_PARAMS_ADDR + 0xBC = YM TL save (32 bytes, $FF = unknown)
+ * Attenuations are in 0.75 dB units ranging from 0 to 127.
+ */
+#define XGM_LEVEL_UPD_ADDR      (XGM_PARAMS_ADDR + 0x93)
+#define XGM_FADE_UPD_ADDR       (XGM_PARAMS_ADDR + 0x94)
+#define XGM_FADE_RUN_ADDR       (XGM_PARAMS_ADDR + 0x95)
+#define XGM_LEVEL_FM_ADDR       (XGM_PARAMS_ADDR + 0x97)
+#define XGM_LEVEL_PSG_ADDR      (XGM_PARAMS_ADDR + 0x98)
+#define XGM_FADE_END_ADDR       (XGM_PARAMS_ADDR + 0x99)
+#define XGM_FADE_STEP_ADDR      (XGM_PARAMS_ADDR + 0x9A)
+#define XGM_LEVEL_SAV_ADDR      (XGM_PARAMS_ADDR + 0xBC)
+#define XGM_LEVEL_SAV_SIZE      32
+#define XGM_VOLUME_MAX          127
+/* Set while the XGM driver processes a music frame (it writes the PSG) */
+#define XGM_PSG_BUSY_ADDR       (XGM_PARAMS_ADDR + 0x9C)
+/* PSG channels used by the sfx, the XGM driver never restores them */
+#define XGM_PSG_SFX_ADDR        (XGM_PARAMS_ADDR + 0x9F)
+
 /* 
  * "Dummy" music sequence which contains commands to reset / turn off the
  * YM2612 sounds. It it used in sound_music_stop function to silent and put
@@ -87,17 +117,68 @@ const uint8_t xgm_reset_sequence[XGM_RESET_SEQUENCE_SIZE] = {
 
 /* XGM variables for sound synchronisation */
 /* Default reference music tempo in ticks per second: 60 */
+#define XGM_TEMPO_DEFAULT   60
+/* Maximum music tempo, it keeps the tempo counter in range (10x speed) */
+#define XGM_TEMPO_MAX       600
+/* Music tempo in ticks per second */
 static uint16_t xgm_tempo;
 /* System music tempo in ticks per second: 60 in NTSC, 50 in PAL */
 static uint16_t xgm_tempo_def;
 /* Counter for music synchronization */
 static int16_t xgm_tempo_cnt;
+/* Ticks not posted yet to the z80 because it was busy */
+static uint16_t xgm_pending_frames;
+/* The z80 pending frames counter is a byte */
+#define XGM_PENDING_FRAMES_MAX  0xFF
+
+/* Frames where the ticks couldn't be posted and were deferred */
+static uint16_t sound_sync_deferred;
+/* 68k cycles in one scanline, the HV counter deltas are in 1/256 scanlines */
+#define SOUND_SYNC_LINE_CYCLES  488
+/* HV counter time the old busy wait spent (only with SOUND_SYNC_MEASURE) */
+static uint32_t sound_sync_wait_time;
 
 /* Next channel that sould be used for sfx */
 static uint16_t sound_sfx_next_channel;
 /* Is sfx muted? */
 static bool sound_sfx_muted;
 
+/*
+ * Sound command queue. Commands are collected during the frame and committed
+ * to the z80 in sound_update, so there is only one bus request per frame.
+ * There is one slot per PCM channel, so repeated triggers on the same channel
+ * are merged keeping the one with the highest priority (the last one on ties).
+ */
+/* Channels with a pending sfx command (bit n = PCM channel n) */
+static volatile uint8_t sound_sfx_queue_mask;
+/* Sample id and priority of the pending sfx command on each channel */
+static uint8_t sound_sfx_queue_id[4];
+static uint8_t sound_sfx_queue_priority[4];
+
+/* Pending music command, only the last one in a frame is committed */
+#define SOUND_MUSIC_CMD_NONE    0
+#define SOUND_MUSIC_CMD_PLAY    1
+#define SOUND_MUSIC_CMD_PAUSE   2
+#define SOUND_MUSIC_CMD_RESUME  3
+#define SOUND_MUSIC_CMD_STOP    4
+static volatile uint8_t sound_music_cmd;
+/* Sample id table and music data address prepared by sound_music_play */
+static uint8_t sound_music_ids[0x100 - 4];
+static uint32_t sound_music_addr;
+
+/* Pending music volume and fade commands (flags) */
+#define SOUND_LEVEL_CMD_VOLUME  0x01
+#define SOUND_LEVEL_CMD_FADE    0x02
+static volatile uint8_t sound_level_cmd;
+/* FM and PSG attenuation set by sound_music_volume_set */
+static uint8_t sound_level_fm;
+static uint8_t sound_level_psg;
+/* Fade target attenuation and step (8.8 fixed point) */
+static uint8_t sound_fade_end;
+static int16_t sound_fade_step;
+/* Fade state read from the XGM driver in the last sound_update */
+static bool sound_fade_running;
+
 
 void sound_init(void)
 {
@@ -142,17 +223,236 @@ void sound_init(void)
     /* Skip channel 0 for sfx as it is normally used for music */
     sound_sfx_next_channel = 1;
     sound_sfx_muted = false;
+    sound_sfx_queue_mask = 0;
+    sound_music_cmd = SOUND_MUSIC_CMD_NONE;
     /* Initialize XGM synchronisation variables */
-    xgm_tempo = 60;
+    xgm_tempo = XGM_TEMPO_DEFAULT;
 	xgm_tempo_def = smd_is_pal() ? 50 : 60;
     xgm_tempo_cnt = 0;
+    xgm_pending_frames = 0;
+    sound_fade_running = false;
+    sound_sync_stats_reset();
+}
+
+/**
+ * @brief Sets the XGM music data address
+ *
+ * @param addr Music data address
+ */
+static inline void sound_music_addr_set(const uint32_t addr)
+{
+    XGM_PARAMS_ADDR[0] = addr >> 0;
+    XGM_PARAMS_ADDR[1] = addr >> 8;
+    XGM_PARAMS_ADDR[2] = addr >> 16;
+    XGM_PARAMS_ADDR[3] = addr >> 24;
+}
+
+/**
+ * @brief Sets a XGM music command clearing the previous ones
+ *
+ * @param command XGM_COMMAND_PLAY, XGM_COMMAND_PAUSE or XGM_COMMAND_RESUME
+ */
+static inline void sound_music_command_set(const uint8_t command)
+{
+    /* Clear previous commands */
+    *XGM_COMMAND_ADDR &= XGM_COMMAND_CLEAR;
+    /* Set the XGM driver command */
+    *XGM_COMMAND_ADDR |= command;
+    /* Clear pending frame */
+    XGM_PARAMS_ADDR[0x0F] = 0;
+    xgm_pending_frames = 0;
+}
+
+/**
+ * @brief Forgets the YM TL levels saved by the XGM driver
+ *
+ * The driver rewrites them when the FM attenuation changes, so they must not
+ * leak from a song to the next one.
+ */
+static inline void sound_music_levels_clear(void)
+{
+    uint16_t i;
+
+    for (i = 0; i < XGM_LEVEL_SAV_SIZE; ++i)
+    {
+        XGM_LEVEL_SAV_ADDR[i] = 0xFF;
+    }
+}
+
+/**
+ * @brief Sends the queued music volume and fade commands to the XGM driver
+ *
+ * @note The z80 bus must be requested before calling this function
+ */
+static inline void sound_level_commit(void)
+{
+    uint8_t cmd;
+
+    cmd = sound_level_cmd;
+    if (cmd & SOUND_LEVEL_CMD_VOLUME)
+    {
+        XGM_LEVEL_FM_ADDR[0] = sound_level_fm;
+        XGM_LEVEL_PSG_ADDR[0] = sound_level_psg;
+        *XGM_LEVEL_UPD_ADDR = 1;
+    }
+    if (cmd & SOUND_LEVEL_CMD_FADE)
+    {
+        XGM_FADE_END_ADDR[0] = sound_fade_end;
+        XGM_FADE_STEP_ADDR[0] = sound_fade_step;
+        XGM_FADE_STEP_ADDR[1] = sound_fade_step >> 8;
+        *XGM_FADE_UPD_ADDR = 1;
+    }
+    sound_level_cmd = 0;
+}
+
+/**
+ * @brief Sends the queued sound commands to the XGM driver
+ *
+ * @note The z80 bus must be requested before calling this function
+ */
+static inline void sound_queue_commit(void)
+{
+    volatile uint8_t *pcm_params;
+    uint8_t mask;
+    uint16_t channel;
+
+    switch (sound_music_cmd)
+    {
+    case SOUND_MUSIC_CMD_PLAY:
+        /*
+         * Upload sample id table (first entry is silent sample, we don't
+         * transfer it)
+         */
+        z80_data_load(sound_music_ids, 0x1C00 + 4, 0x100 - 4);
+        sound_music_levels_clear();
+        sound_music_addr_set(sound_music_addr);
+        sound_music_command_set(XGM_COMMAND_PLAY);
+        break;
+
+    case SOUND_MUSIC_CMD_PAUSE:
+        sound_music_command_set(XGM_COMMAND_PAUSE);
+        break;
+
+    case SOUND_MUSIC_CMD_RESUME:
+        /* Check if we are already playing a song */
+        if ((*XGM_COMMAND_ADDR & XGM_COMMAND_PLAY) == 0)
+        {
+            sound_music_command_set(XGM_COMMAND_RESUME);
+        }
+        break;
+
+    case SOUND_MUSIC_CMD_STOP:
+        /*
+         * To stop a song and put the XGM driver in a healthy state, it needs a
+         * special sequence to be played
+         */
+        sound_music_levels_clear();
+        sound_music_addr_set((uint32_t) xgm_reset_sequence);
+        sound_music_command_set(XGM_COMMAND_PLAY);
+        break;
+    }
+    sound_music_cmd = SOUND_MUSIC_CMD_NONE;
+
+    mask = sound_sfx_queue_mask;
+    if (mask)
+    {
+        /*
+         * Set PCM priority and sample id to play:
+         * XGM_PARAMS_ADDR + 0x04 = PCM0 priority
+         * XGM_PARAMS_ADDR + 0x05 = PCM0 sample id
+         * XGM_PARAMS_ADDR + 0x06 = PCM1 priority
+         * XGM_PARAMS_ADDR + 0x07 = PCM1 sample id
+         * XGM_PARAMS_ADDR + 0x08 = PCM2 priority
+         * XGM_PARAMS_ADDR + 0x09 = PCM2 sample id
+         * XGM_PARAMS_ADDR + 0x0A = PCM3 priority
+         * XGM_PARAMS_ADDR + 0x0B = PCM3 sample id
+         */
+        pcm_params = XGM_PARAMS_ADDR + 0x04;
+        for (channel = 0; channel < 4; ++channel)
+        {
+            if (mask & (1 << channel))
+            {
+                pcm_params[0] = sound_sfx_queue_priority[channel];
+                pcm_params[1] = sound_sfx_queue_id[channel];
+            }
+            pcm_params += 2;
+        }
+
+        /* 
+         * Set XGM driver play PCM channel commands at once
+         * XGM_COMMAND_PLAY_PCM0 = 0x01
+         * XGM_COMMAND_PLAY_PCM1 = 0x02
+         * XGM_COMMAND_PLAY_PCM2 = 0x04
+         * XGM_COMMAND_PLAY_PCM3 = 0x08
+         */
+        *XGM_COMMAND_ADDR |= mask;
+        sound_sfx_queue_mask = 0;
+    }
 }
 
+/**
+ * @brief Adds a PCM sample play command to the sound command queue
+ *
+ * @param id Sample id in the XGM sample table to play
+ * @param priority Playing priority ranging from 0 (lowest) to 15 highest
+ * @param channel Desired channel to play the sample
+ */
+static void sound_sfx_queue(const uint8_t id, const uint8_t priority,
+                            const uint16_t channel)
+{
+    uint8_t bit = 1 << channel;
+
+    /* Don't let sound_update commit a half written slot */
+    smd_ints_disable();
+    if (!(sound_sfx_queue_mask & bit) ||
+        priority >= sound_sfx_queue_priority[channel])
+    {
+        sound_sfx_queue_priority[channel] = priority;
+        sound_sfx_queue_id[channel] = id;
+        sound_sfx_queue_mask |= bit;
+    }
+    smd_ints_enable();
+}
+
+#if SOUND_SYNC_MEASURE
+/**
+ * @brief Times the busy wait the old synchronisation did on a deferred frame
+ * 
+ * It polls MODIFYING_F the same way (bus request, check, bus release and a
+ * MOVEM delay) until the z80 clears it and accumulates the HV counter delta.
+ * The ticks are still posted in the next frame.
+ */
+static void sound_sync_wait_measure(void)
+{
+    uint16_t start = *VDP_PORT_HV_COUNTER;
+    uint16_t time;
+    bool busy;
+
+    do
+    {
+        /* Wait a bit (about 80 cycles) */
+        __asm__ volatile ("\t\tmovm.l %d0-%d3,-(%sp)\n");
+        __asm__ volatile ("\t\tmovm.l (%sp)+,%d0-%d3\n");
+        z80_bus_request();
+        busy = XGM_PARAMS_ADDR[0x0E];
+        z80_bus_release();
+    }
+    while (busy);
+    /* V counter in the high byte, a jump back in the vblank is discarded */
+    time = *VDP_PORT_HV_COUNTER - start;
+    if (time < 0x8000)
+    {
+        sound_sync_wait_time += time;
+    }
+}
+#endif
+
 inline void sound_update(void)
 {
     int16_t cnt = xgm_tempo_cnt;
     uint16_t step = xgm_tempo_def;
     uint16_t num = 0;
+    uint16_t pending;
 
     /* 
      * Calculates number of pending frame depending on whether system is in PAL
@@ -167,29 +467,83 @@ inline void sound_update(void)
     }
     xgm_tempo_cnt = cnt - xgm_tempo;
 
-    while (true)
+    z80_prof_site_set(Z80_PROF_SOUND);
+    z80_bus_request();
+    /* Commit the commands queued in this frame in the same bus request */
+    if (sound_sfx_queue_mask || sound_music_cmd != SOUND_MUSIC_CMD_NONE)
     {
-        z80_bus_request();
-        /* 
-         * XGM MODIFYING_F (0x0E) variable controls whether the z80 is accessing
-         * the PENDING_FRM (0x0F) variable or not. We check here if this is
-         * happening and wait for the z80 to finish doing it.
-         */
-        if (!XGM_PARAMS_ADDR[0x0E])
-        {
-            break;
-        }
-        z80_bus_release();
+        sound_queue_commit();
+    }
+    if (sound_level_cmd)
+    {
+        sound_level_commit();
+    }
+    /* A committed fade is running until the z80 starts and finishes it */
+    sound_fade_running = *XGM_FADE_UPD_ADDR || *XGM_FADE_RUN_ADDR;
+    /*
+     * PSG sfx are written while the z80 is stopped so their tone pairs can't
+     * be split. If the bus request caught the z80 in the middle of a music
+     * frame they are skipped, the next frame rewrites them.
+     */
+    *XGM_PSG_SFX_ADDR = psg_sfx_channels_get();
+    if (!*XGM_PSG_BUSY_ADDR)
+    {
+        psg_sfx_commit();
+    }
+    xgm_pending_frames += num;
+    if (xgm_pending_frames > XGM_PENDING_FRAMES_MAX)
+    {
+        xgm_pending_frames = XGM_PENDING_FRAMES_MAX;
+    }
 
-        /* Wait a bit (about 80 cycles) */
-        __asm__ volatile ("\t\tmovm.l %d0-%d3,-(%sp)\n");
-        __asm__ volatile ("\t\tmovm.l (%sp)+,%d0-%d3\n");        
+    /* 
+     * XGM MODIFYING_F (0x0E) variable controls whether the z80 is accessing
+     * the PENDING_FRM (0x0F) variable or not. If it is busy, we don't wait for
+     * it, the ticks are kept and posted in the next frame.
+     */
+    if (XGM_PARAMS_ADDR[0x0E])
+    {
+        z80_bus_release();
+        ++sound_sync_deferred;
+#if SOUND_SYNC_MEASURE
+        sound_sync_wait_measure();
+#endif
+        return;
     }
     /* 
      * XGM PENDING_FRM (0x0F) variable contains number of XGM frame to process.
-     * Increment it here.
+     * Increment it here without wrapping it, the ticks which don't fit are
+     * kept for the next frame.
      */
-    XGM_PARAMS_ADDR[0x0F] += num;
+    pending = XGM_PARAMS_ADDR[0x0F];
+    if (xgm_pending_frames > XGM_PENDING_FRAMES_MAX - pending)
+    {
+        xgm_pending_frames -= XGM_PENDING_FRAMES_MAX - pending;
+        pending = XGM_PENDING_FRAMES_MAX;
+    }
+    else
+    {
+        pending += xgm_pending_frames;
+        xgm_pending_frames = 0;
+    }
+    XGM_PARAMS_ADDR[0x0F] = pending;
+    z80_bus_release();
+}
+
+inline uint16_t sound_sync_deferred_get(void)
+{
+    return sound_sync_deferred;
+}
+
+inline uint32_t sound_sync_wait_cycles_get(void)
+{
+    return (sound_sync_wait_time * SOUND_SYNC_LINE_CYCLES) >> 8;
+}
+
+void sound_sync_stats_reset(void)
+{
+    sound_sync_deferred = 0;
+    sound_sync_wait_time = 0;
 }
 
 void sound_sfx_set(const uint8_t id, const uint8_t *sample,
@@ -208,40 +562,9 @@ void sound_sfx_set(const uint8_t id, const uint8_t *sample,
 
 void sound_sfx_play(const uint8_t id, uint8_t priority, const uint16_t channel)
 {
-    volatile uint8_t *pcm_params;
-
     if (!sound_sfx_muted)
     {
-        smd_ints_disable();
-        z80_bus_request();
-
-        pcm_params = XGM_PARAMS_ADDR + 0x04 + (channel * 2);
-
-        /*
-         * Set PCM priority and sample id to play:
-         * XGM_PARAMS_ADDR + 0x04 = PCM0 priority
-         * XGM_PARAMS_ADDR + 0x05 = PCM0 sample id
-         * XGM_PARAMS_ADDR + 0x06 = PCM1 priority
-         * XGM_PARAMS_ADDR + 0x07 = PCM1 sample id
-         * XGM_PARAMS_ADDR + 0x08 = PCM2 priority
-         * XGM_PARAMS_ADDR + 0x09 = PCM2 sample id
-         * XGM_PARAMS_ADDR + 0x0A = PCM3 priority
-         * XGM_PARAMS_ADDR + 0x0B = PCM3 sample id
-         */
-        pcm_params[0] = priority & 0xF;
-        pcm_params[1] = id;
-
-        /* 
-         * Set XGM driver play PCM channel command
-         * XGM_COMMAND_PLAY_PCM0 = 0x01
-         * XGM_COMMAND_PLAY_PCM1 = 0x02
-         * XGM_COMMAND_PLAY_PCM2 = 0x04
-         * XGM_COMMAND_PLAY_PCM3 = 0x08
-         */
-        *XGM_COMMAND_ADDR |= (1 << channel);
-
-        z80_bus_release();
-        smd_ints_enable();
+        sound_sfx_queue(id, priority & 0xF, channel);
 
         /* Adjust play auto next channel skipping channel 0 */
         sound_sfx_next_channel = channel + 1;
@@ -252,8 +575,23 @@ void sound_sfx_play(const uint8_t id, uint8_t priority, const uint16_t channel)
     }
 }
 
-inline void sound_sfx_play_auto(const uint8_t id, uint8_t priority)
+void sound_sfx_play_auto(const uint8_t id, uint8_t priority)
 {
+    uint16_t channel;
+
+    /* The same sample triggered again in this frame reuses its channel */
+    for (channel = 1; channel < 4; ++channel)
+    {
+        if ((sound_sfx_queue_mask & (1 << channel)) &&
+            sound_sfx_queue_id[channel] == id)
+        {
+            if (!sound_sfx_muted)
+            {
+                sound_sfx_queue(id, priority & 0xF, channel);
+            }
+            return;
+        }
+    }
     sound_sfx_play(id, priority, sound_sfx_next_channel);
 }
 
@@ -290,10 +628,12 @@ inline bool sound_sfx_is_muted(void)
 
 void sound_music_play(const uint8_t *song)
 {
-    uint8_t ids[0x100 - 4];
     uint32_t addr;
     uint16_t i;
 
+    /* Don't let sound_update upload the table while it is being prepared */
+    sound_music_cmd = SOUND_MUSIC_CMD_NONE;
+
     /* Prepare sample id table */
     for(i = 0; i < 0x3F; ++i)
     {
@@ -313,19 +653,13 @@ void sound_music_play(const uint8_t *song)
         }
 
         /* Write adjusted addr */
-        ids[(i * 4) + 0] = addr >> 8;
-        ids[(i * 4) + 1] = addr >> 16;
+        sound_music_ids[(i * 4) + 0] = addr >> 8;
+        sound_music_ids[(i * 4) + 1] = addr >> 16;
         /* and recopy len */
-        ids[(i * 4) + 2] = song[(i * 4) + 2];
-        ids[(i * 4) + 3] = song[(i * 4) + 3];
+        sound_music_ids[(i * 4) + 2] = song[(i * 4) + 2];
+        sound_music_ids[(i * 4) + 3] = song[(i * 4) + 3];
     }
 
-    smd_ints_disable();
-    z80_bus_request();
-
-    /* Upload sample id table (first entry is silent sample, we don't transfer it) */
-    z80_data_load(ids, 0x1C00 + 4, 0x100 - 4);
-
     /* Get song address and bypass sample id table */
     addr = ((uint32_t) song) + 0x100;
     /* bypass sample data (use the sample data size) */
@@ -333,85 +667,94 @@ void sound_music_play(const uint8_t *song)
     addr += ((uint32_t) song[0xFD]) << 16;
     /* and bypass the music data size field */
     addr += 4;
+    sound_music_addr = addr;
 
-    /* Set XGM music data address */
-    XGM_PARAMS_ADDR[0] = addr >> 0;
-    XGM_PARAMS_ADDR[1] = addr >> 8;
-    XGM_PARAMS_ADDR[2] = addr >> 16;
-    XGM_PARAMS_ADDR[3] = addr >> 24;
+    sound_music_cmd = SOUND_MUSIC_CMD_PLAY;
+}
 
-    /* Clear previous commands */
-    *XGM_COMMAND_ADDR &= XGM_COMMAND_CLEAR;
-    /* Set XGM driver play XGM command */
-    *XGM_COMMAND_ADDR |= XGM_COMMAND_PLAY;
-    /* Clear pending frame */
-    XGM_PARAMS_ADDR[0x0F] = 0;
+inline void sound_music_pause(void)
+{
+    sound_music_cmd = SOUND_MUSIC_CMD_PAUSE;
+}
 
-    z80_bus_release();
-    smd_ints_enable();
+inline void sound_music_resume(void)
+{
+    sound_music_cmd = SOUND_MUSIC_CMD_RESUME;
 }
 
-void sound_music_pause(void)
+inline void sound_music_stop(void)
 {
-    smd_ints_disable();
-    z80_bus_request();
+    sound_music_cmd = SOUND_MUSIC_CMD_STOP;
+}
 
-    /* Clear previous commands */
-    *XGM_COMMAND_ADDR &= XGM_COMMAND_CLEAR;
-    /* Set XGM driver pause XGM command */
-    *XGM_COMMAND_ADDR |= XGM_COMMAND_PAUSE;
-    /* Clear pending frame */
-    XGM_PARAMS_ADDR[0x0F] = 0;    
-    
-    z80_bus_release();
-    smd_ints_enable();
+inline void sound_music_tempo_set(const uint16_t tempo)
+{
+    /* One word write, so sound_update always sees a valid value */
+    xgm_tempo = tempo > XGM_TEMPO_MAX ? XGM_TEMPO_MAX : tempo;
 }
 
-void sound_music_resume(void)
+inline uint16_t sound_music_tempo_get(void)
 {
-    smd_ints_disable();
-    z80_bus_request();
+    return xgm_tempo;
+}
 
-    /* Check if we are already playing a song */
-    if ((*XGM_COMMAND_ADDR & XGM_COMMAND_PLAY) == 0)
-    {
-        /* Clear previous commands */
-        *XGM_COMMAND_ADDR &= XGM_COMMAND_CLEAR;
-        /* Set XGM driver resume XGM command */
-        *XGM_COMMAND_ADDR |= XGM_COMMAND_RESUME;        
-        /* Clear pending frame */
-        XGM_PARAMS_ADDR[0x0F] = 0;    
-    }    
-    z80_bus_release();
+inline void sound_music_tempo_reset(void)
+{
+    xgm_tempo = XGM_TEMPO_DEFAULT;
+}
+
+void sound_music_volume_set(const uint8_t fm, const uint8_t psg)
+{
+    smd_ints_disable();
+    sound_level_fm = XGM_VOLUME_MAX -
+                     (fm > XGM_VOLUME_MAX ? XGM_VOLUME_MAX : fm);
+    sound_level_psg = XGM_VOLUME_MAX -
+                      (psg > XGM_VOLUME_MAX ? XGM_VOLUME_MAX : psg);
+    sound_level_cmd |= SOUND_LEVEL_CMD_VOLUME;
     smd_ints_enable();
 }
 
-void sound_music_stop(void)
+/**
+ * @brief Queues a music fade to the target attenuation
+ *
+ * @param end Target attenuation (0 to 127)
+ * @param frames Fade duration in music frames, 0 fades at once
+ */
+static void sound_music_fade(const uint8_t end, const uint16_t frames)
 {
-    uint32_t addr;
+    int16_t step;
 
-    /* 
-     * To stop a song and put the XGM driver in a healthy state, it needs a
-     * special sequence to be played
-     */
-    addr = (uint32_t) xgm_reset_sequence;
+    /* Full attenuation range in 8.8 fixed point */
+    step = XGM_VOLUME_MAX << 8;
+    if (frames > 1)
+    {
+        step /= frames;
+        /* Don't stall on very long fades */
+        if (step == 0)
+        {
+            step = 1;
+        }
+    }
 
     smd_ints_disable();
-    z80_bus_request();
+    sound_fade_end = end;
+    sound_fade_step = end ? step : -step;
+    sound_level_cmd |= SOUND_LEVEL_CMD_FADE;
+    smd_ints_enable();
+}
 
-    /* Set stop sequence as XGM music data address */
-    XGM_PARAMS_ADDR[0] = addr >> 0;
-    XGM_PARAMS_ADDR[1] = addr >> 8;
-    XGM_PARAMS_ADDR[2] = addr >> 16;
-    XGM_PARAMS_ADDR[3] = addr >> 24;
+inline void sound_music_fade_out(const uint16_t frames)
+{
+    sound_music_fade(XGM_VOLUME_MAX, frames);
+}
 
-    /* Clear previous commands */
-    *XGM_COMMAND_ADDR &= XGM_COMMAND_CLEAR;
-    /* Set XGM driver play XGM command */
-    *XGM_COMMAND_ADDR |= XGM_COMMAND_PLAY;
-    /* Clear pending frame */
-    XGM_PARAMS_ADDR[0x0F] = 0;
+inline void sound_music_fade_in(const uint16_t frames)
+{
+    sound_music_fade(0, frames);
+}
 
-    z80_bus_release();
-    smd_ints_enable();
+inline bool sound_music_is_fading(void)
+{
+    /* Queued but not sent yet, or sent and not finished in the last frame */
+    return (sound_level_cmd & SOUND_LEVEL_CMD_FADE) || sound_fade_running;
 }
@@ -14,6 +14,10 @@
  * PCM channels at a fixed 14 Khz and allows to play sfx through PCM with 16
  * level of priority. The driver is designed to avoid DMA contention when
  * possible (depending CPU load).
+ * SFX and music commands are not sent to the z80 immediately. They are queued
+ * and committed in the next vblank by sound_update using a single z80 bus
+ * request, so triggering several sounds in a frame doesn't stall the PCM mixer
+ * several times.
  *
  * More info:
  * https://github.com/Stephane-D/SGDK
@@ -40,13 +44,44 @@ void sound_init(void);
 /**
  * @brief Manages sound synchronization
  * 
- * Handles the sound timing notifying the z80 in each frame.
+ * Handles the sound timing notifying the z80 in each frame and commits the
+ * sound commands queued since the last call. It never waits for the z80: if
+ * the XGM driver is updating its pending frames counter, the ticks are kept and
+ * posted in the next frame.
  * 
  * @note This function is called automatically in the vint so you don't need to
  * call it. 
  */
 void sound_update(void);
 
+/**
+ * @brief Gets the number of frames the music ticks were deferred
+ * 
+ * Each deferral is a frame where the z80 was updating its pending frames
+ * counter, so the old synchronisation would have busy waited for it in the
+ * vblank. It is a count of frames, not a measure of the time saved.
+ * 
+ * @return uint16_t Number of deferred frames since the last stats reset
+ */
+uint16_t sound_sync_deferred_get(void);
+
+/**
+ * @brief Gets the cycles the old synchronisation spent waiting for the z80
+ * 
+ * It is only measured when SOUND_SYNC_MEASURE is set in config.h: then each
+ * deferred frame busy waits for the z80 like the old code and times it with
+ * the HV counter, otherwise it is always 0. The HV counter is not linear, so
+ * it is an approximation (one scanline is 488 cycles).
+ * 
+ * @return uint32_t Cycles spent waiting since the last stats reset
+ */
+uint32_t sound_sync_wait_cycles_get(void);
+
+/**
+ * @brief Resets the synchronisation stats
+ */
+void sound_sync_stats_reset(void);
+
 /**
  * @brief Adds a PCM sample to the XGM sample table
  * 
@@ -56,6 +91,9 @@ void sound_update(void);
  * By design the XGM driver needs its samples aligned to 256 bytes boundary with
  * a size multiple of 256.
  * 
+ * Samples in far rom banks (see mapper.h) must be mapped with mapper_far_map
+ * and stay mapped while they are played.
+ * 
  * @param id XGM sample table id to define
  * @param sample Sample address (must be aligned to 256 bytes boundary)
  * @param length Sample size in bytes (must be multiple of 256 bytes)
@@ -83,6 +121,10 @@ void sound_sfx_set(const uint8_t id, const uint8_t *sample,
  * @param id Sample id in the XGM sample table to play
  * @param priority Playing priority ranging from 0 (lowest) to 15 highest
  * @param channel Desired channel to play the sample
+ * 
+ * @note The command is queued and sent in the next vblank. If several samples
+ * are played on the same channel in a frame, only the one with the highest
+ * priority (the last one on ties) is sent.
  */
 void sound_sfx_play(const uint8_t id, uint8_t priority, const uint16_t channel);
 
@@ -96,6 +138,9 @@ void sound_sfx_play(const uint8_t id, uint8_t priority, const uint16_t channel);
  * 
  * @param id Sample id in the XGM sample table to play
  * @param priority Playing priority ranging from 0 (lowest) to 15 highest
+ * 
+ * @note A sample already queued in this frame reuses its channel, so repeated
+ * triggers of the same sfx don't take several channels.
  */
 void sound_sfx_play_auto(const uint8_t id, uint8_t priority);
 
@@ -133,6 +178,9 @@ bool sound_sfx_is_muted(void);
  * VGM files to XGC.
  * 
  * @param song XGM track address
+ * 
+ * @note Music commands are queued and sent in the next vblank. Only the last
+ * one in a frame is sent.
  */
 void sound_music_play(const uint8_t *song);
 
@@ -157,4 +205,79 @@ void sound_music_resume(void);
  */
 void sound_music_stop(void);
 
+/**
+ * @brief Sets the music tempo
+ * 
+ * XGM music is composed at 60 ticks per second. sound_update posts the ticks
+ * needed each frame to reach the selected tempo, so the z80 plays the song
+ * faster or slower without extra work (i.e. 90 plays it at 150% speed, 30 at
+ * 50%). It works the same in PAL and NTSC systems.
+ * 
+ * @param tempo Music tempo in ticks per second, 60 is the normal speed, 0
+ * stops the music timing and values over 600 are clamped
+ */
+void sound_music_tempo_set(const uint16_t tempo);
+
+/**
+ * @brief Gets the music tempo
+ * 
+ * @return uint16_t Music tempo in ticks per second
+ */
+uint16_t sound_music_tempo_get(void);
+
+/**
+ * @brief Restores the normal music tempo (60 ticks per second)
+ */
+void sound_music_tempo_reset(void);
+
+/**
+ * @brief Sets the music FM and PSG volumes
+ * 
+ * The XGM driver attenuates the FM carriers and the PSG envelopes of the song
+ * on the fly, so the music can be mixed with the sfx or ducked i.e. while a
+ * dialog is shown. The volumes are combined with the fade level. PCM channels
+ * are not affected.
+ * 
+ * @param fm FM volume ranging from 0 (silent) to 127 (full volume)
+ * @param psg PSG volume ranging from 0 (silent) to 127 (full volume)
+ * 
+ * @note Volumes use 0.75 dB steps (PSG is rounded to its 2 dB steps). FM
+ * volume needs songs converted with the xgmtool in this kit, which sends the
+ * YM TL writes as level commands the driver can attenuate.
+ */
+void sound_music_volume_set(const uint8_t fm, const uint8_t psg);
+
+/**
+ * @brief Fades out the music
+ * 
+ * The fade starts from the current fade level and advances while the music
+ * plays, so it follows the music tempo and stops while the music is paused.
+ * 
+ * @param frames Fade duration in music frames (60 per second), 0 silences the
+ * music at once
+ */
+void sound_music_fade_out(const uint16_t frames);
+
+/**
+ * @brief Fades in the music
+ * 
+ * Fades the music back to the volumes set by sound_music_volume_set. Call it
+ * after a sound_music_fade_out, i.e. right after sound_music_play to start a
+ * song from silence.
+ * 
+ * @param frames Fade duration in music frames (60 per second), 0 restores the
+ * music at once
+ */
+void sound_music_fade_in(const uint16_t frames);
+
+/**
+ * @brief Checks whether a music fade is in progress
+ * 
+ * The driver state is read in sound_update, so a fade is reported from the
+ * moment it is queued until the vblank after the z80 finished it.
+ * 
+ * @return True if the music is fading, false otherwise
+ */
+bool sound_music_is_fading(void);
+
 #endif /* SOUND_H */
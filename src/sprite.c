@@ -5,7 +5,108 @@
  * Github: https://github.com/tapule/mddev
  *
  * File: sprite.c
- * ??
+ * VDP's sprites functions
  */
 
+#include <stddef.h>
 #include "sprite.h"
+#include "config.h"
+#include "dma.h"
+
+/* Sprite table copy in RAM */
+static sprite_t sprite_table[SPRITE_MAX];
+/* Number of sprites in the table */
+static uint8_t sprite_count;
+
+void sprite_init(void)
+{
+    sprite_clear();
+}
+
+inline void sprite_clear(void)
+{
+    sprite_count = 0;
+}
+
+bool sprite_add(const int16_t x, const int16_t y, const uint8_t size,
+                const uint16_t attr)
+{
+    sprite_t *sprite;
+
+    if (sprite_count >= SPRITE_MAX)
+    {
+        return false;
+    }
+    sprite = &sprite_table[sprite_count];
+    sprite->y = y + 128;
+    sprite->size = size;
+    sprite->attr = attr;
+    sprite->x = x + 128;
+    ++sprite_count;
+
+    return true;
+}
+
+sprite_t *sprite_alloc(const uint8_t count)
+{
+    sprite_t *sprite;
+
+    if (sprite_count + count > SPRITE_MAX)
+    {
+        return NULL;
+    }
+    sprite = &sprite_table[sprite_count];
+    sprite_count += count;
+
+    return sprite;
+}
+
+inline uint8_t sprite_count_get(void)
+{
+    return sprite_count;
+}
+
+void sprite_update(void)
+{
+    uint8_t i;
+
+    /* An empty table still needs a sprite, hide it out of the screen */
+    if (sprite_count == 0)
+    {
+        sprite_table[0].y = 0;
+        sprite_table[0].size = 0;
+        sprite_table[0].attr = 0;
+        sprite_table[0].x = 0;
+        sprite_table[0].link = 0;
+        dma_queue_vram_transfer(sprite_table, VID_SPRITE_TABLE_ADDR, 4, 2);
+        return;
+    }
+
+    /* Each sprite links to the next one, the last one ends the list */
+    for (i = 1; i < sprite_count; ++i)
+    {
+        sprite_table[i - 1].link = i;
+    }
+    sprite_table[sprite_count - 1].link = 0;
+
+    dma_queue_vram_transfer(sprite_table, VID_SPRITE_TABLE_ADDR,
+                            sprite_count * 4, 2);
+}
+
+inline uint16_t sprite_attr_config(const uint16_t tile_index,
+                                   const uint16_t palette,
+                                   const uint16_t h_flip, const uint16_t v_flip,
+                                   const uint16_t priority)
+{
+    return (priority << 15) | (palette << 13) | (v_flip << 12) |
+           (h_flip << 11) | tile_index;
+}
+
+inline uint16_t sprite_attr_operator_config(const uint16_t tile_index,
+                                            const uint16_t h_flip,
+                                            const uint16_t v_flip)
+{
+    /* Low priority, so high priority plane cells still cover the operator */
+    return sprite_attr_config(tile_index, SPRITE_SH_OPERATOR_PAL, h_flip,
+                              v_flip, 0);
+}
@@ -5,17 +5,145 @@
  * Github: https://github.com/tapule/mddev
  *
  * File: sprite.h
- * ??
+ * VDP's sprites functions
  *
- * ??
+ * Sprites are defined in the VDP's sprite table stored in VRam. Each sprite
+ * has an attribute word describing what tile to draw and how to draw it using
+ * the same format used by plane cells:
+ *      PCCVHTTTTTTTTTTT
+ *      P: Priority flag
+ *      C: Palete select
+ *      V: Vertical flip flag
+ *      H: Horizontal flip flag
+ *      T: Tile index in VRam to drawn
+ *
+ * Sprites are added each frame to a sprite table copy in RAM, which is sent to
+ * VRam using the DMA queue with sprite_update. Sprite coordinates are in
+ * screen pixels, the internal 128 pixels offset is added here.
  *
  * More info:
+ * https://www.plutiedev.com/sprites
  * 
  */
 
 #ifndef SPRITE_H
 #define SPRITE_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
+/* 
+ * Palette used by shadow/highlight operator sprites. Their pixels with colors
+ * 14 or 15 highlight or shadow the pixels below them.
+ */
+#define SPRITE_SH_OPERATOR_PAL  3
+
+/* Maximum number of sprites in the sprite table (H40 mode) */
+#define SPRITE_MAX  80
+
+/* Sprite size from its width and height in tiles (1..4) */
+#define SPRITE_SIZE(width, height)  ((((width) - 1) << 2) | ((height) - 1))
+
+/* Sprite width and height in pixels from its size */
+#define SPRITE_WIDTH(size)  (((((size) >> 2) & 0x03) + 1) << 3)
+#define SPRITE_HEIGHT(size) ((((size) & 0x03) + 1) << 3)
+
+/* Sprite table entry, in the same format the VDP uses */
+typedef struct sprite_t
+{
+    uint16_t y;         /* Vertical position plus 128 */
+    uint8_t size;       /* Width and height in tiles (see SPRITE_SIZE) */
+    uint8_t link;       /* Next sprite to draw, set by sprite_update */
+    uint16_t attr;      /* Sprite attributes (see sprite_attr_config) */
+    uint16_t x;         /* Horizontal position plus 128 */
+} sprite_t;
+
+/**
+ * @brief Initialises the sprite table
+ * 
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void sprite_init(void);
+
+/**
+ * @brief Removes all the sprites from the sprite table
+ * 
+ * Call it at the start of each frame, before adding the frame sprites.
+ */
+void sprite_clear(void);
+
+/**
+ * @brief Adds a sprite to the sprite table
+ * 
+ * @param x Horizontal position in screen pixels
+ * @param y Vertical position in screen pixels
+ * @param size Width and height in tiles (see SPRITE_SIZE)
+ * @param attr Sprite attributes (see sprite_attr_config)
+ * @return true on success, false if the sprite table is full
+ */
+bool sprite_add(const int16_t x, const int16_t y, const uint8_t size,
+                const uint16_t attr);
+
+/**
+ * @brief Reserves consecutive entries in the sprite table
+ * 
+ * Lets batched code write sprites directly in the table without a function
+ * call per sprite. Positions must include the 128 pixels offset and link
+ * fields can be ignored.
+ * 
+ * @param count Number of entries to reserve
+ * @return sprite_t* First reserved entry or NULL if there is not enough space
+ */
+sprite_t *sprite_alloc(const uint8_t count);
+
+/**
+ * @brief Gets the number of sprites in the sprite table
+ * 
+ * @return uint8_t Sprites in the table
+ */
+uint8_t sprite_count_get(void);
 
+/**
+ * @brief Sends the sprite table to VRam
+ * 
+ * Links the sprites in the table and queues its DMA transfer, so it will be
+ * done in the next dma_queue_flush.
+ * 
+ * @note The table must not be changed until the DMA queue is flushed
+ */
+void sprite_update(void);
+
+/**
+ * @brief Configures a sprite attribute with all its draw properties
+ * 
+ * @param tile_index VRam index of the first sprite tile
+ * @param palette CRam palete index (0..3)
+ * @param h_flip Horizontal flip property (0 no flip, 1 flip horizontally)
+ * @param v_flip Vertical flip property (0 no flip, 1 flip vertically)
+ * @param priority Drawing priority (0 low priority, 1 high priority)
+ * @return uint16_t Sprite attribute with all the properties configured in
+ * 
+ * @note In shadow/highlight mode low priority sprites are shadowed like the
+ * planes below them, high priority ones are drawn normally.
+ */
+uint16_t sprite_attr_config(const uint16_t tile_index, const uint16_t palette,
+                            const uint16_t h_flip, const uint16_t v_flip,
+                            const uint16_t priority);
+
+/**
+ * @brief Configures a shadow/highlight operator sprite attribute
+ * 
+ * Operator sprites use the palette 3, so their pixels with colors 14 and 15
+ * highlight or shadow whatever is below them instead of being drawn.
+ * 
+ * @param tile_index VRam index of the first sprite tile
+ * @param h_flip Horizontal flip property (0 no flip, 1 flip horizontally)
+ * @param v_flip Vertical flip property (0 no flip, 1 flip vertically)
+ * @return uint16_t Sprite attribute with all the properties configured in
+ */
+uint16_t sprite_attr_operator_config(const uint16_t tile_index,
+                                     const uint16_t h_flip,
+                                     const uint16_t v_flip);
 
 #endif /* SPRITE_H */
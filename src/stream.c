@@ -0,0 +1,198 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: stream.c
+ * Time sliced streaming decompression to VRam
+ */
+
+#include "stream.h"
+#include "config.h"
+#include "vdp.h"
+#include "dma.h"
+
+/* Each window half is sent to VRam when it is full */
+#define STREAM_HALF         (STREAM_WINDOW / 2)
+#define STREAM_MASK         (STREAM_WINDOW - 1)
+
+/* Decompression window, it must be word aligned for the DMA */
+_Alignas(2) static uint8_t stream_window[STREAM_WINDOW];
+
+/* Current stream state */
+static const uint8_t *stream_src;   /* Next compressed byte */
+static uint16_t stream_dest;        /* VRam address of the next chunk */
+static uint16_t stream_left;        /* Bytes left to decode */
+static uint16_t stream_pos;         /* Next write position in the window */
+static uint16_t stream_run;         /* Bytes left in the current token */
+static uint16_t stream_match;       /* Match read position in the window */
+static bool stream_is_match;        /* Current token is a match */
+static bool stream_pending;         /* A full chunk couldn't be queued */
+
+/**
+ * @brief Queues the window half containing the last decoded byte
+ *
+ * @return true on success, false if the DMA queue is full
+ */
+static bool stream_chunk_queue(void)
+{
+    uint16_t last;
+    uint16_t length;
+
+    last = (stream_pos - 1) & STREAM_MASK;
+    length = (last & (STREAM_HALF - 1)) + 1;
+    if (!dma_queue_vram_transfer(&stream_window[last & ~(STREAM_HALF - 1)],
+                                 stream_dest, length >> 1, 2))
+    {
+        return false;
+    }
+    stream_dest += length;
+
+    return true;
+}
+
+/**
+ * @brief Decodes the next slice of the current stream
+ *
+ * @param bytes Maximum number of bytes to decode
+ * @param lines Time budget in scanlines, 0 for no time budget
+ * @return true if the stream is done, false otherwise
+ */
+static bool stream_decode(uint16_t bytes, const uint8_t lines)
+{
+    uint8_t *window;
+    uint8_t start_line;
+    uint8_t queued;
+    uint8_t token;
+    uint16_t count;
+    uint16_t pos;
+
+    /* Send the chunk which didn't fit in the DMA queue last time */
+    queued = 0;
+    if (stream_pending)
+    {
+        if (!stream_chunk_queue())
+        {
+            return false;
+        }
+        stream_pending = false;
+        queued = 1;
+    }
+
+    window = stream_window;
+    start_line = *VDP_PORT_HV_COUNTER >> 8;
+    while (stream_left && bytes)
+    {
+        /* Read the next token */
+        if (stream_run == 0)
+        {
+            if (lines &&
+                (uint8_t) ((*VDP_PORT_HV_COUNTER >> 8) - start_line) >= lines)
+            {
+                break;
+            }
+            token = *stream_src++;
+            if (token & 0x80)
+            {
+                stream_run = ((token >> 3) & 0x0F) + 3;
+                stream_match = ((token & 0x07) << 8) | *stream_src++;
+                stream_match = (stream_pos - stream_match - 1) & STREAM_MASK;
+                stream_is_match = true;
+            }
+            else
+            {
+                stream_run = token + 1;
+                stream_is_match = false;
+            }
+        }
+
+        /* Decode up to the end of the token, the budget or the window half */
+        count = STREAM_HALF - (stream_pos & (STREAM_HALF - 1));
+        if (count > stream_run)
+        {
+            count = stream_run;
+        }
+        if (count > bytes)
+        {
+            count = bytes;
+        }
+        if (count > stream_left)
+        {
+            count = stream_left;
+        }
+        stream_run -= count;
+        stream_left -= count;
+        bytes -= count;
+
+        pos = stream_pos;
+        if (stream_is_match)
+        {
+            uint16_t match = stream_match;
+
+            for (; count; --count)
+            {
+                window[pos++] = window[match];
+                match = (match + 1) & STREAM_MASK;
+            }
+            stream_match = match;
+        }
+        else
+        {
+            const uint8_t *src = stream_src;
+
+            for (; count; --count)
+            {
+                window[pos++] = *src++;
+            }
+            stream_src = src;
+        }
+        stream_pos = pos & STREAM_MASK;
+
+        /* Send full halves (or the last one) to VRam */
+        if ((stream_pos & (STREAM_HALF - 1)) == 0 || stream_left == 0)
+        {
+            if (!stream_chunk_queue())
+            {
+                stream_pending = true;
+                return false;
+            }
+            /*
+             * The other half may be waiting in the DMA queue since this slice,
+             * it can't be overwritten until the queue is flushed
+             */
+            if (++queued == 2)
+            {
+                break;
+            }
+        }
+    }
+
+    return stream_done();
+}
+
+void stream_start(const uint8_t *src, const uint16_t dest)
+{
+    /* Decompressed size header */
+    stream_left = (src[0] << 8) | src[1];
+    stream_src = src + 2;
+    stream_dest = dest;
+    stream_pos = 0;
+    stream_run = 0;
+    stream_pending = false;
+}
+
+inline bool stream_step(uint16_t bytes)
+{
+    return stream_decode(bytes, 0);
+}
+
+inline bool stream_step_lines(const uint8_t lines)
+{
+    return stream_decode(0xFFFF, lines);
+}
+
+inline bool stream_done(void)
+{
+    return stream_left == 0 && !stream_pending;
+}
@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: stream.h
+ * Time sliced streaming decompression to VRam
+ *
+ * Decompresses a resource to VRam in small slices, so new graphics can be
+ * loaded while the game is running without long stalls.
+ * Each call to stream_step decodes a bounded amount of data, a number of bytes
+ * or until a number of scanlines have passed (measured with the HV counter).
+ * Decoded data is written in a small window in RAM whose halves are queued in
+ * the DMA queue as soon as they are full, so they are sent to VRam in the next
+ * dma_queue_flush.
+ *
+ * Resources are compressed with bintoc using the -c option. The format is a
+ * simple LZ77 variant:
+ *  - 2 bytes header with the decompressed size (big endian, even).
+ *  - 0x00..0x7F: Literals run, the next (token + 1) bytes are copied.
+ *  - 0x80..0xFF: Match of ((token >> 3) & 0x0F) + 3 bytes copied from
+ *    (((token & 0x07) << 8) | next byte) + 1 bytes back in the output.
+ *
+ * Usage example:
+ *  stream_start(res_level2_tiles, 0x4000);
+ *  while (!stream_done())
+ *  {
+ *      ...game frame...
+ *      stream_step_lines(20);
+ *      vid_vsync_wait();
+ *      dma_queue_flush();
+ *  }
+ *
+ * @note Only one stream can run at a time. Call one stream_step function per
+ * frame at most, the DMA queue must be flushed between calls.
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Starts a new streaming decompression
+ *
+ * @param src Compressed resource in ROM/RAM
+ * @param dest Destination address in VRam
+ *
+ * @note Any running stream is cancelled
+ */
+void stream_start(const uint8_t *src, const uint16_t dest);
+
+/**
+ * @brief Decompresses the next slice of the current stream
+ *
+ * @param bytes Maximum number of bytes to decode in this slice
+ * @return true if the stream is done, false otherwise
+ */
+bool stream_step(uint16_t bytes);
+
+/**
+ * @brief Decompresses the next slice of the current stream within a time budget
+ *
+ * Decodes until the given number of scanlines have passed since the call. The
+ * time is checked after each compressed token, so the budget can be exceeded
+ * by a few cycles.
+ *
+ * @param lines Time budget in scanlines
+ * @return true if the stream is done, false otherwise
+ */
+bool stream_step_lines(const uint8_t lines);
+
+/**
+ * @brief Checks if the current stream is done
+ *
+ * @return true if all the data has been decoded and queued, false otherwise
+ */
+bool stream_done(void);
+
+#endif /* STREAM_H */
@@ -0,0 +1,154 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: task.c
+ * Cooperative task scheduler
+ */
+
+#include "task.h"
+#include "config.h"
+
+/* Registers saved by task_switch (d2-d7/a2-a6) */
+#define TASK_SAVED_REGS 11
+
+/* Task status */
+#define TASK_FREE       0
+#define TASK_ALIVE      1
+
+/* Task control block */
+typedef struct task_t
+{
+    uint32_t sp;            /* Saved stack pointer while it is stopped */
+    task_func_t func;       /* Task function */
+    void *arg;              /* Task function argument */
+    uint16_t wait;          /* Frames to wait before running again */
+    uint8_t status;         /* TASK_FREE or TASK_ALIVE */
+} task_t;
+
+static task_t tasks[TASK_MAX];
+/* Tasks' stacks, as longs to keep them aligned */
+static uint32_t task_stacks[TASK_MAX][TASK_STACK_SIZE / 4];
+/* Scheduler stack pointer while a task is running */
+static uint32_t task_scheduler_sp;
+/* Task running now */
+static task_t *task_current;
+
+/**
+ * @brief Saves the current context and resumes other one
+ *
+ * @param save_sp Where to save the current stack pointer
+ * @param load_sp Stack pointer of the context to resume
+ *
+ * @note Implemented in task_switch.s
+ */
+void task_switch(uint32_t *save_sp, const uint32_t load_sp);
+
+/**
+ * @brief First code executed by a new task
+ *
+ * task_switch returns here the first time a task runs. It calls the task
+ * function and ends the task when it returns.
+ */
+static void task_start(void)
+{
+    task_current->func(task_current->arg);
+
+    /* The task is done, it won't be resumed anymore */
+    task_current->status = TASK_FREE;
+    task_switch(&task_current->sp, task_scheduler_sp);
+}
+
+void task_init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < TASK_MAX; ++i)
+    {
+        tasks[i].status = TASK_FREE;
+    }
+    task_current = 0;
+}
+
+int8_t task_create(const task_func_t func, void *arg)
+{
+    uint32_t *stack;
+    uint8_t i;
+    uint8_t j;
+
+    for (i = 0; i < TASK_MAX; ++i)
+    {
+        if (tasks[i].status == TASK_FREE)
+        {
+            /*
+             * Builds the stack as task_switch leaves it, so the first switch
+             * pops zeroed registers and returns to task_start
+             */
+            stack = &task_stacks[i][TASK_STACK_SIZE / 4];
+            /* Fake return address for task_start, it never returns */
+            *--stack = 0;
+            *--stack = (uint32_t) task_start;
+            for (j = 0; j < TASK_SAVED_REGS; ++j)
+            {
+                *--stack = 0;
+            }
+
+            tasks[i].sp = (uint32_t) stack;
+            tasks[i].func = func;
+            tasks[i].arg = arg;
+            tasks[i].wait = 0;
+            tasks[i].status = TASK_ALIVE;
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void task_kill(const int8_t id)
+{
+    if (id >= 0 && id < TASK_MAX && &tasks[id] != task_current)
+    {
+        tasks[id].status = TASK_FREE;
+    }
+}
+
+bool task_alive(const int8_t id)
+{
+    return id >= 0 && id < TASK_MAX && tasks[id].status == TASK_ALIVE;
+}
+
+void task_run(void)
+{
+    task_t *task;
+
+    for (task = tasks; task < &tasks[TASK_MAX]; ++task)
+    {
+        if (task->status != TASK_ALIVE)
+        {
+            continue;
+        }
+        if (task->wait)
+        {
+            --task->wait;
+            continue;
+        }
+        task_current = task;
+        task_switch(&task_scheduler_sp, task->sp);
+    }
+    task_current = 0;
+}
+
+void task_yield(void)
+{
+    task_switch(&task_current->sp, task_scheduler_sp);
+}
+
+void task_wait_frames(const uint16_t frames)
+{
+    /* The next task_run call already counts as one frame */
+    task_current->wait = frames ? frames - 1 : 0;
+    task_yield();
+}
@@ -0,0 +1,115 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: task.h
+ * Cooperative task scheduler
+ *
+ * Tasks are functions with their own small stack which can stop in the middle
+ * of their code and continue later, so cutscenes, AI scripts or loading
+ * sequences can be written as straight code instead of state machines spread
+ * over several frames.
+ * The scheduler is cooperative: task_run executes each task in turn until it
+ * calls task_yield or task_wait_frames, or until its function returns, which
+ * ends the task. Call task_run once per frame, after vid_vsync_wait.
+ * Long background jobs (i.e. decompressing the next level) can do a small
+ * chunk of work and yield, so the work is spread over several frames.
+ *
+ * Usage example:
+ *  void intro(void *arg)
+ *  {
+ *      uint16_t text[8];
+ *      uint16_t size;
+ *
+ *      size = text_render("Hello", text);
+ *      plane_hline_draw(PLANE_A, text, 1, 1, size, false);
+ *      task_wait_frames(60);
+ *      size = text_render("World", text);
+ *      plane_hline_draw(PLANE_A, text, 1, 2, size, false);
+ *  }
+ *  task_create(intro, NULL);
+ *  while (1)
+ *  {
+ *      vid_vsync_wait();
+ *      task_run();
+ *  }
+ *
+ * @note Tasks must not be switched from interrupt handlers. Stack sizes are
+ * small (TASK_STACK_SIZE in config.h), avoid deep calls and big local arrays.
+ * Interrupts raised while a task runs use its stack too: the VBlank handler
+ * (raster_update, psg_sfx_update and sound_update) and the HBlank handler with
+ * its raster callbacks need about 256 bytes on top of what the task uses.
+ */
+
+#ifndef TASK_H
+#define TASK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Task function type */
+typedef void (*task_func_t)(void *arg);
+
+/**
+ * @brief Initialises the task scheduler
+ *
+ * @note This function is called from the boot process so maybe you don't need
+ * to call it anymore.
+ */
+void task_init(void);
+
+/**
+ * @brief Creates a new task
+ *
+ * The task starts running in the next task_run call.
+ *
+ * @param func Task function, the task ends when it returns
+ * @param arg Argument passed to the task function
+ * @return int8_t Task identifier or -1 if there are no free tasks
+ */
+int8_t task_create(const task_func_t func, void *arg);
+
+/**
+ * @brief Ends a task
+ *
+ * @param id Task identifier
+ *
+ * @note A task can't kill itself, it must return from its function instead
+ */
+void task_kill(const int8_t id);
+
+/**
+ * @brief Checks if a task is still alive
+ *
+ * @param id Task identifier
+ * @return true if the task is alive, false otherwise
+ */
+bool task_alive(const int8_t id);
+
+/**
+ * @brief Runs all the tasks
+ *
+ * Each alive task which isn't waiting runs until it yields or ends. Tasks run
+ * in creation order.
+ */
+void task_run(void);
+
+/**
+ * @brief Stops the current task until the next task_run call
+ *
+ * @note It must only be called from inside a task
+ */
+void task_yield(void);
+
+/**
+ * @brief Stops the current task for a number of frames
+ *
+ * @param frames Number of task_run calls to wait, 0 or 1 is like task_yield
+ *
+ * @note It must only be called from inside a task
+ */
+void task_wait_frames(const uint16_t frames);
+
+#endif /* TASK_H */
@@ -0,0 +1,30 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: task_switch.s
+ * Cooperative tasks context switch
+ * 
+ * Hand written m68k context switch used by the task scheduler (task.c). It is
+ * always called as a regular function, so only the registers the GCC m68k
+ * calling convention asks to preserve (d2-d7/a2-a6) are saved in the stack
+ * before swapping the stack pointers. The return address is already in the
+ * stack, so rts resumes the other context.
+ */
+
+.section .text
+
+/**
+ * void task_switch(uint32_t *save_sp, const uint32_t load_sp)
+ */
+.global task_switch
+task_switch:
+    move.l  4(sp), a0               /* Where to save the current stack */
+    move.l  8(sp), d0               /* Stack to resume */
+    movem.l d2-d7/a2-a6, -(sp)
+    move.l  sp, (a0)
+    move.l  d0, sp
+    movem.l (sp)+, d2-d7/a2-a6
+    rts
@@ -0,0 +1,54 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test.h
+ * Minimal checks for the host built tests
+ *
+ * The pure C modules (no VDP, z80 or m68k assembly) are built with the host
+ * compiler and checked here. Each test program returns the number of failed
+ * checks, so make stops at the first failing one.
+ */
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+
+/* Number of failed checks in this test program */
+static unsigned test_failures;
+
+/**
+ * @brief Checks a condition and reports it when it fails
+ *
+ * @param cond Condition to check
+ * @param ... printf like message describing the failure
+ */
+#define TEST_CHECK(cond, ...)                                                  \
+do                                                                             \
+{                                                                              \
+    if (!(cond))                                                               \
+    {                                                                          \
+        printf("%s:%d: ", __FILE__, __LINE__);                                 \
+        printf(__VA_ARGS__);                                                   \
+        printf("\n");                                                          \
+        ++test_failures;                                                       \
+    }                                                                          \
+} while (0)
+
+/**
+ * @brief Prints the test program result
+ *
+ * @param name Test program name
+ * @return int Value to return from main, 0 if all the checks passed
+ */
+static inline int test_report(const char *name)
+{
+    printf("%s: %s (%u failed)\n", name, test_failures ? "FAIL" : "OK",
+           test_failures);
+    return test_failures ? 1 : 0;
+}
+
+#endif /* TEST_H */
@@ -0,0 +1,84 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test_arena.c
+ * Per frame arena checks
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "test.h"
+#include "arena.h"
+#include "config.h"
+
+static void test_arena_alloc(void)
+{
+    uint8_t *a;
+    uint8_t *b;
+
+    arena_init();
+    TEST_CHECK(arena_used() == 0, "new arena used %u", arena_used());
+
+    a = arena_alloc(3);
+    b = arena_alloc(5);
+    TEST_CHECK(a != NULL && b != NULL, "small allocs failed");
+    TEST_CHECK(((uintptr_t) a & 1) == 0 && ((uintptr_t) b & 1) == 0,
+               "buffers are not word aligned");
+    TEST_CHECK(b == a + 4, "odd size was not rounded up to a word");
+    TEST_CHECK(arena_used() == 10, "used %u, not 10", arena_used());
+    TEST_CHECK(arena_alloc(0) != NULL && arena_used() == 10,
+               "empty alloc used memory");
+}
+
+static void test_arena_full(void)
+{
+    uint8_t *a;
+
+    arena_init();
+    a = arena_alloc(ARENA_SIZE);
+    TEST_CHECK(a != NULL, "whole arena alloc failed");
+    TEST_CHECK(arena_alloc(1) == NULL, "full arena allocated");
+    TEST_CHECK(arena_used() == ARENA_SIZE, "used %u, not %u", arena_used(),
+               ARENA_SIZE);
+
+    arena_reset();
+    TEST_CHECK(arena_alloc(ARENA_SIZE + 1) == NULL, "oversized alloc");
+    TEST_CHECK(arena_alloc(0xFFFF) == NULL, "0xFFFF bytes alloc");
+    TEST_CHECK(arena_used() == 0, "failed allocs used %u", arena_used());
+    TEST_CHECK(arena_alloc(ARENA_SIZE) == a, "reset didn't free the arena");
+}
+
+static void test_arena_high_water(void)
+{
+    arena_init();
+    TEST_CHECK(arena_high_water() == 0, "new high water %u",
+               arena_high_water());
+
+    /* The peak is kept across resets, the biggest frame wins */
+    arena_alloc(100);
+    arena_alloc(100);
+    arena_reset();
+    TEST_CHECK(arena_used() == 0, "reset kept %u bytes", arena_used());
+    arena_alloc(50);
+    TEST_CHECK(arena_high_water() == 200, "high water %u, not 200",
+               arena_high_water());
+    arena_reset();
+    arena_alloc(300);
+    TEST_CHECK(arena_high_water() == 300, "high water %u, not 300",
+               arena_high_water());
+
+    arena_init();
+    TEST_CHECK(arena_high_water() == 0, "init kept the high water");
+}
+
+int main(void)
+{
+    test_arena_alloc();
+    test_arena_full();
+    test_arena_high_water();
+
+    return test_report("arena");
+}
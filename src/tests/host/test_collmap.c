@@ -0,0 +1,220 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test_collmap.c
+ * Collision map checks against an unpacked copy of the map
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "test.h"
+#include "collmap.h"
+
+/* Map size in tiles, odd widths check the row padding */
+#define TEST_MAP_WIDTH  37
+#define TEST_MAP_HEIGHT 23
+/* Random boxes checked in each map */
+#define TEST_MAP_BOXES  20000
+
+/* Unpacked map and the packed one given to collmap */
+static uint8_t test_map[TEST_MAP_HEIGHT][TEST_MAP_WIDTH];
+static uint8_t test_map_packed[TEST_MAP_HEIGHT * ((TEST_MAP_WIDTH + 1) / 2)];
+static uint8_t test_map_bits;
+
+static uint32_t test_map_seed = 0x9E3779B9;
+
+/**
+ * @brief Gets a pseudo random value in a range (xorshift)
+ *
+ * @param min Lowest value
+ * @param max Highest value
+ * @return int16_t Random value
+ */
+static int16_t test_map_rand(const int16_t min, const int16_t max)
+{
+    test_map_seed ^= test_map_seed << 13;
+    test_map_seed ^= test_map_seed >> 17;
+    test_map_seed ^= test_map_seed << 5;
+    return min + (int16_t) (test_map_seed % (uint32_t) (max - min + 1));
+}
+
+/**
+ * @brief Gets a tile of the unpacked map
+ *
+ * @param x Tile column
+ * @param y Tile row
+ * @return uint8_t Tile value, solid outside the map
+ */
+static uint8_t test_map_tile(const int16_t x, const int16_t y)
+{
+    if (x < 0 || y < 0 || x >= TEST_MAP_WIDTH || y >= TEST_MAP_HEIGHT)
+    {
+        return COLLMAP_SOLID;
+    }
+    return test_map[y][x];
+}
+
+/**
+ * @brief Builds a random map (mostly empty) and packs it as collmaptool does
+ *
+ * @param bits Bits per tile, 2 or 4
+ */
+static void test_map_build(const uint8_t bits)
+{
+    uint16_t pitch = (TEST_MAP_WIDTH * bits + 7) >> 3;
+    uint16_t shift;
+    int16_t x;
+    int16_t y;
+
+    test_map_bits = bits;
+    for (x = 0; x < (int16_t) sizeof(test_map_packed); ++x)
+    {
+        test_map_packed[x] = 0;
+    }
+    for (y = 0; y < TEST_MAP_HEIGHT; ++y)
+    {
+        for (x = 0; x < TEST_MAP_WIDTH; ++x)
+        {
+            test_map[y][x] = (test_map_rand(0, 3) == 0) ?
+                             test_map_rand(1, (1 << bits) - 1) : 0;
+            /* First tile in the high bits of each byte */
+            shift = 8 - bits - (x * bits & 7);
+            test_map_packed[y * pitch + ((x * bits) >> 3)] |=
+                test_map[y][x] << shift;
+        }
+    }
+    collmap_set(test_map_packed, TEST_MAP_WIDTH, TEST_MAP_HEIGHT, bits);
+    collmap_border_set(COLLMAP_SOLID);
+}
+
+/**
+ * @brief Checks a box against the unpacked map
+ *
+ * @param x Box left position in pixels
+ * @param y Box top position in pixels
+ * @param width Box width in pixels
+ * @param height Box height in pixels
+ * @param mask Collision values to check
+ * @param row_first Rows above this one are not checked
+ * @return true if any tile under the box matches the mask
+ */
+static bool test_map_box(const int16_t x, const int16_t y,
+                         const uint16_t width, const uint16_t height,
+                         const uint16_t mask, const int16_t row_first)
+{
+    int16_t row;
+    int16_t col;
+
+    for (row = y >> 3; row <= (y + height - 1) >> 3; ++row)
+    {
+        for (col = x >> 3; col <= (x + width - 1) >> 3; ++col)
+        {
+            if (row >= row_first &&
+                (COLLMAP_MASK(test_map_tile(col, row)) & mask))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void test_map_tiles(void)
+{
+    int16_t x;
+    int16_t y;
+
+    for (y = -2; y < TEST_MAP_HEIGHT + 2; ++y)
+    {
+        for (x = -2; x < TEST_MAP_WIDTH + 2; ++x)
+        {
+            TEST_CHECK(collmap_tile_get(x, y) == test_map_tile(x, y),
+                       "%u bits tile (%d, %d) = %u, not %u", test_map_bits, x,
+                       y, collmap_tile_get(x, y), test_map_tile(x, y));
+        }
+    }
+    TEST_CHECK(collmap_point_get(8 * 3 + 7, 8 * 5) == test_map_tile(3, 5),
+               "point (31, 40) is not tile (3, 5)");
+
+    collmap_border_set(COLLMAP_EMPTY);
+    TEST_CHECK(collmap_tile_get(-1, 0) == COLLMAP_EMPTY, "border not set");
+    collmap_border_set(COLLMAP_SOLID);
+}
+
+static void test_map_boxes(void)
+{
+    const uint16_t block = COLLMAP_MASK_BLOCK;
+    const uint16_t solid = COLLMAP_MASK_BLOCK &
+                           ~COLLMAP_MASK(COLLMAP_PLATFORM);
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+    int16_t d;
+    int16_t ref;
+    int16_t step;
+    uint32_t i;
+
+    for (i = 0; i < TEST_MAP_BOXES; ++i)
+    {
+        x = test_map_rand(-16, TEST_MAP_WIDTH * 8 + 8);
+        y = test_map_rand(-16, TEST_MAP_HEIGHT * 8 + 8);
+        width = test_map_rand(1, 24);
+        height = test_map_rand(1, 24);
+        d = test_map_rand(-40, 40);
+
+        TEST_CHECK(collmap_box_test(x, y, width, height, block) ==
+                   test_map_box(x, y, width, height, block, -32),
+                   "box (%d, %d, %u, %u) test", x, y, width, height);
+
+        /* Sweeps start from free positions */
+        if (test_map_box(x, y, width, height, solid, -32))
+        {
+            continue;
+        }
+
+        /* Horizontal sweeps are only stopped by non platform tiles */
+        step = (d < 0) ? -1 : 1;
+        for (ref = 0; ref != d; ref += step)
+        {
+            if (test_map_box(x + ref + step, y, width, height, solid, -32))
+            {
+                break;
+            }
+        }
+        TEST_CHECK(collmap_sweep_x(x, y, width, height, d, block) == ref,
+                   "sweep_x (%d, %d, %u, %u) by %d = %d, not %d", x, y, width,
+                   height, d, collmap_sweep_x(x, y, width, height, d, block),
+                   ref);
+
+        /* Falling boxes land on the platforms below them */
+        for (ref = 0; ref != d; ref += step)
+        {
+            if (test_map_box(x, y + ref + step, width, height, solid, -32) ||
+                (d > 0 && test_map_box(x, y + ref + step, width, height,
+                                       block, ((y + height - 1) >> 3) + 1)))
+            {
+                break;
+            }
+        }
+        TEST_CHECK(collmap_sweep_y(x, y, width, height, d, block) == ref,
+                   "sweep_y (%d, %d, %u, %u) by %d = %d, not %d", x, y, width,
+                   height, d, collmap_sweep_y(x, y, width, height, d, block),
+                   ref);
+    }
+}
+
+int main(void)
+{
+    test_map_build(2);
+    test_map_tiles();
+    test_map_boxes();
+    test_map_build(4);
+    test_map_tiles();
+    test_map_boxes();
+
+    return test_report("collmap");
+}
@@ -0,0 +1,226 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test_fix.c
+ * Fixed point math checks against double precision references
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <math.h>
+#include "test.h"
+#include "fix.h"
+#include "fix_tables.h"
+
+/* Random values generated */
+#define TEST_FIX_VALUES 100000
+/* Pi, M_PI is not standard C */
+#define TEST_FIX_PI 3.14159265358979323846
+/* Largest error allowed in fix_atan2, in angle steps */
+#define TEST_FIX_ATAN_ERROR 2
+
+static uint32_t test_fix_seed = 0x12345678;
+
+/**
+ * @brief Gets a pseudo random 32 bits value (xorshift)
+ *
+ * @return uint32_t Random value
+ */
+static uint32_t test_fix_rand(void)
+{
+    test_fix_seed ^= test_fix_seed << 13;
+    test_fix_seed ^= test_fix_seed >> 17;
+    test_fix_seed ^= test_fix_seed << 5;
+    return test_fix_seed;
+}
+
+/**
+ * @brief Gets a random signed value with a random magnitude up to 2^bits - 1
+ *
+ * @param bits Maximum bits of the magnitude
+ * @return int32_t Random value
+ */
+static int32_t test_fix_rand_signed(const uint16_t bits)
+{
+    int32_t value = test_fix_rand() >> (32 - (test_fix_rand() % bits + 1));
+
+    return (test_fix_rand() & 1) ? -value : value;
+}
+
+/**
+ * @brief Gets the distance between two angles in steps, going the short way
+ *
+ * @param a First angle
+ * @param b Second angle
+ * @return uint16_t Distance in steps
+ */
+static uint16_t test_fix_angle_dist(const fix_angle_t a, const fix_angle_t b)
+{
+    uint16_t dist = (a - b) & FIX_ANGLE_MASK;
+
+    return (dist > FIX_ANGLE_180) ? FIX_ANGLE_STEPS - dist : dist;
+}
+
+/**
+ * @brief Gets the exact angle of a vector in steps, rounded
+ *
+ * @param y Vertical component of the vector
+ * @param x Horizontal component of the vector
+ * @return fix_angle_t Angle of the vector
+ */
+static fix_angle_t test_fix_angle_ref(const double y, const double x)
+{
+    double angle = atan2(y, x) * FIX_ANGLE_STEPS / (2.0 * TEST_FIX_PI);
+
+    return (fix_angle_t) lround(angle) & FIX_ANGLE_MASK;
+}
+
+static void test_fix_mul(void)
+{
+    int32_t a;
+    int32_t b;
+    int64_t ref;
+    uint32_t i;
+
+    for (i = 0; i < TEST_FIX_VALUES; ++i)
+    {
+        /* Operands whose product fits in 16.16 */
+        a = test_fix_rand_signed(31);
+        b = test_fix_rand_signed(46 - (31 - __builtin_clz(llabs(a) | 1)));
+        /* The magnitude is truncated, so the result rounds towards zero */
+        ref = ((int64_t) llabs(a) * llabs(b)) >> 16;
+        ref = ((a < 0) != (b < 0)) ? -ref : ref;
+        TEST_CHECK(fix16_mul(a, b) == ref, "fix16_mul(%d, %d) = %d, not %lld",
+                   a, b, fix16_mul(a, b), (long long) ref);
+    }
+    TEST_CHECK(fix16_mul(FIX16(1.5), FIX16(-2.0)) == FIX16(-3.0),
+               "fix16_mul(1.5, -2.0) != -3.0");
+}
+
+static void test_fix_mul_fix8(void)
+{
+    int32_t a;
+    int16_t b;
+    int64_t ref;
+    uint32_t i;
+
+    for (i = 0; i < TEST_FIX_VALUES; ++i)
+    {
+        a = test_fix_rand_signed(23);
+        b = test_fix_rand_signed(15);
+        ref = ((int64_t) llabs(a) * abs(b)) >> 8;
+        ref = ((a < 0) != (b < 0)) ? -ref : ref;
+        TEST_CHECK(fix16_mul_fix8(a, b) == ref,
+                   "fix16_mul_fix8(%d, %d) = %d, not %lld", a, b,
+                   fix16_mul_fix8(a, b), (long long) ref);
+    }
+}
+
+static void test_fix_div_int(void)
+{
+    int32_t a;
+    uint8_t n;
+    int64_t ref;
+    int64_t result;
+    uint32_t i;
+
+    for (i = 0; i < TEST_FIX_VALUES; ++i)
+    {
+        a = test_fix_rand_signed(31);
+        n = test_fix_rand() % 255 + 1;
+        ref = llabs(a) / n;
+        result = llabs(fix16_div_int(a, n));
+        /* Rounded up reciprocals can add one unit to the magnitude */
+        TEST_CHECK(result == ref || result == ref + 1,
+                   "fix16_div_int(%d, %u) = %d, exact %lld", a, n,
+                   fix16_div_int(a, n), (long long) (a < 0 ? -ref : ref));
+        TEST_CHECK(result == 0 || (fix16_div_int(a, n) < 0) == (a < 0),
+                   "fix16_div_int(%d, %u) has the wrong sign", a, n);
+    }
+}
+
+static void test_fix8(void)
+{
+    TEST_CHECK(fix8_mul(FIX8(1.5), FIX8(-2.0)) == FIX8(-3.0),
+               "fix8_mul(1.5, -2.0) = %d", fix8_mul(FIX8(1.5), FIX8(-2.0)));
+    TEST_CHECK(fix8_div(FIX8(-3.0), FIX8(2.0)) == FIX8(-1.5),
+               "fix8_div(-3.0, 2.0) = %d", fix8_div(FIX8(-3.0), FIX8(2.0)));
+    TEST_CHECK(fix8_div(FIX8(1.0), FIX8(3.0)) == 85,
+               "fix8_div(1.0, 3.0) = %d", fix8_div(FIX8(1.0), FIX8(3.0)));
+}
+
+static void test_fix_sin_cos(void)
+{
+    double ref;
+    uint16_t angle;
+
+    for (angle = 0; angle < FIX_ANGLE_STEPS; ++angle)
+    {
+        /* The table is 2.14 fixed point, one unit is 4 in 16.16 */
+        ref = sin(angle * 2.0 * TEST_FIX_PI / FIX_ANGLE_STEPS) * 65536.0;
+        TEST_CHECK(fabs(fix16_sin(angle) - ref) <= 4.0,
+                   "fix16_sin(%u) = %d, exact %f", angle, fix16_sin(angle),
+                   ref);
+        TEST_CHECK(fix16_cos(angle) == fix16_sin(angle + FIX_ANGLE_90),
+                   "fix16_cos(%u) is not a shifted sine", angle);
+        TEST_CHECK(fix8_sin(angle) == (fix16_sin(angle) >> 8),
+                   "fix8_sin(%u) = %d, fix16_sin %d", angle, fix8_sin(angle),
+                   fix16_sin(angle));
+        /* Angles wrap around */
+        TEST_CHECK(fix16_sin(angle + FIX_ANGLE_STEPS) == fix16_sin(angle),
+                   "fix16_sin(%u) doesn't wrap", angle);
+    }
+}
+
+static void test_fix_atan2(void)
+{
+    int32_t x;
+    int32_t y;
+    fix_angle_t angle;
+    fix_angle_t ref;
+    uint32_t i;
+
+    TEST_CHECK(fix_atan2(0, 0) == 0, "fix_atan2(0, 0) != 0");
+    TEST_CHECK(fix_atan2(0, 5) == 0, "fix_atan2(0, 5) != 0");
+    TEST_CHECK(fix_atan2(5, 0) == FIX_ANGLE_90, "fix_atan2(5, 0) != 90");
+    TEST_CHECK(fix_atan2(0, -5) == FIX_ANGLE_180, "fix_atan2(0, -5) != 180");
+    TEST_CHECK(fix_atan2(-5, 0) == FIX_ANGLE_270, "fix_atan2(-5, 0) != 270");
+    TEST_CHECK(fix_atan2(7, 7) == FIX_ANGLE_45, "fix_atan2(7, 7) != 45");
+
+    /* Vectors built from the sine table give back their angle */
+    for (i = 0; i < FIX_ANGLE_STEPS; ++i)
+    {
+        angle = fix_atan2(fix16_sin(i), fix16_cos(i));
+        TEST_CHECK(test_fix_angle_dist(angle, i) <= 1,
+                   "fix_atan2(sin(%u), cos(%u)) = %u", i, i, angle);
+    }
+
+    for (i = 0; i < TEST_FIX_VALUES; ++i)
+    {
+        x = test_fix_rand_signed(31);
+        y = test_fix_rand_signed(31);
+        if (x == 0 && y == 0)
+        {
+            continue;
+        }
+        angle = fix_atan2(y, x);
+        ref = test_fix_angle_ref(y, x);
+        TEST_CHECK(test_fix_angle_dist(angle, ref) <= TEST_FIX_ATAN_ERROR,
+                   "fix_atan2(%d, %d) = %u, exact %u", y, x, angle, ref);
+    }
+}
+
+int main(void)
+{
+    test_fix_mul();
+    test_fix_mul_fix8();
+    test_fix_div_int();
+    test_fix8();
+    test_fix_sin_cos();
+    test_fix_atan2();
+
+    return test_report("fix");
+}
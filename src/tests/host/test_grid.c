@@ -0,0 +1,237 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test_grid.c
+ * Broad-phase grid checks against a brute force search
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "test.h"
+#include "grid.h"
+#include "config.h"
+
+/* Random frames checked and objects added in each one */
+#define TEST_GRID_FRAMES    200
+#define TEST_GRID_OBJECTS   40
+
+/* Object boxes of the current frame */
+typedef struct test_box_t
+{
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint8_t layer;
+    uint8_t mask;
+} test_box_t;
+
+static test_box_t test_boxes[TEST_GRID_OBJECTS];
+/* Times each pair was reported, indexed by the ids */
+static uint8_t test_seen[TEST_GRID_OBJECTS][TEST_GRID_OBJECTS];
+
+static uint32_t test_grid_seed = 0x2545F491;
+
+/**
+ * @brief Gets a pseudo random value in a range (xorshift)
+ *
+ * @param min Lowest value
+ * @param max Highest value
+ * @return int16_t Random value
+ */
+static int16_t test_grid_rand(const int16_t min, const int16_t max)
+{
+    test_grid_seed ^= test_grid_seed << 13;
+    test_grid_seed ^= test_grid_seed >> 17;
+    test_grid_seed ^= test_grid_seed << 5;
+    return min + (int16_t) (test_grid_seed % (uint32_t) (max - min + 1));
+}
+
+/**
+ * @brief Checks if two boxes overlap (edges touching is not an overlap)
+ *
+ * @param a First box
+ * @param x Second box left coordinate
+ * @param y Second box top coordinate
+ * @param width Second box width
+ * @param height Second box height
+ * @return true if they overlap
+ */
+static bool test_grid_overlap(const test_box_t *a, const int16_t x,
+                              const int16_t y, const uint16_t width,
+                              const uint16_t height)
+{
+    return a->x < x + width && x < a->x + a->width &&
+           a->y < y + height && y < a->y + a->height;
+}
+
+/**
+ * @brief Fills the grid with random boxes, some of them out of its area
+ */
+static void test_grid_frame_build(void)
+{
+    test_box_t *box;
+    uint16_t i;
+
+    grid_clear();
+    for (i = 0; i < TEST_GRID_OBJECTS; ++i)
+    {
+        box = &test_boxes[i];
+        box->x = test_grid_rand(-40, GRID_COLS << GRID_CELL_SHIFT);
+        box->y = test_grid_rand(-40, GRID_ROWS << GRID_CELL_SHIFT);
+        box->width = test_grid_rand(1, 48);
+        box->height = test_grid_rand(1, 48);
+        box->layer = 1 << test_grid_rand(0, 2);
+        box->mask = test_grid_rand(0, 7);
+        TEST_CHECK(grid_add(i, box->x, box->y, box->width, box->height,
+                            box->layer, box->mask), "grid_add %u failed", i);
+    }
+    grid_build();
+}
+
+static void test_grid_pairs(void)
+{
+    const grid_pair_t *pairs;
+    const test_box_t *a;
+    const test_box_t *b;
+    uint16_t count;
+    uint16_t expected;
+    uint16_t i;
+    uint16_t j;
+
+    for (i = 0; i < TEST_GRID_OBJECTS; ++i)
+    {
+        for (j = 0; j < TEST_GRID_OBJECTS; ++j)
+        {
+            test_seen[i][j] = 0;
+        }
+    }
+    count = grid_pairs_find();
+    pairs = grid_pairs_get();
+    for (i = 0; i < count; ++i)
+    {
+        a = &test_boxes[pairs[i].a];
+        b = &test_boxes[pairs[i].b];
+        TEST_CHECK(pairs[i].a != pairs[i].b, "object %u paired with itself",
+                   pairs[i].a);
+        TEST_CHECK(test_grid_overlap(a, b->x, b->y, b->width, b->height),
+                   "pair %u-%u doesn't overlap", pairs[i].a, pairs[i].b);
+        ++test_seen[pairs[i].a][pairs[i].b];
+        ++test_seen[pairs[i].b][pairs[i].a];
+    }
+
+    /* Every overlapping pair with matching layers is reported once */
+    expected = 0;
+    for (i = 0; i < TEST_GRID_OBJECTS; ++i)
+    {
+        a = &test_boxes[i];
+        for (j = i + 1; j < TEST_GRID_OBJECTS; ++j)
+        {
+            b = &test_boxes[j];
+            if (((a->mask & b->layer) || (b->mask & a->layer)) &&
+                test_grid_overlap(a, b->x, b->y, b->width, b->height))
+            {
+                TEST_CHECK(test_seen[i][j] == 1, "pair %u-%u reported %u times",
+                           i, j, test_seen[i][j]);
+                ++expected;
+            }
+            else
+            {
+                TEST_CHECK(test_seen[i][j] == 0, "pair %u-%u was reported", i,
+                           j);
+            }
+        }
+    }
+    TEST_CHECK(count == expected, "%u pairs, not %u", count, expected);
+}
+
+static void test_grid_query(void)
+{
+    uint16_t ids[TEST_GRID_OBJECTS];
+    uint8_t found[TEST_GRID_OBJECTS];
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+    uint8_t mask;
+    uint16_t count;
+    uint16_t i;
+    bool hit;
+
+    x = test_grid_rand(-40, GRID_COLS << GRID_CELL_SHIFT);
+    y = test_grid_rand(-40, GRID_ROWS << GRID_CELL_SHIFT);
+    width = test_grid_rand(1, 96);
+    height = test_grid_rand(1, 96);
+    mask = test_grid_rand(1, 7);
+
+    for (i = 0; i < TEST_GRID_OBJECTS; ++i)
+    {
+        found[i] = 0;
+    }
+    count = grid_query(x, y, width, height, mask, ids, TEST_GRID_OBJECTS);
+    for (i = 0; i < count; ++i)
+    {
+        ++found[ids[i]];
+    }
+    for (i = 0; i < TEST_GRID_OBJECTS; ++i)
+    {
+        hit = (test_boxes[i].layer & mask) &&
+              test_grid_overlap(&test_boxes[i], x, y, width, height);
+        TEST_CHECK(found[i] == (hit ? 1 : 0),
+                   "query (%d, %d, %u, %u) found object %u %u times", x, y,
+                   width, height, i, found[i]);
+    }
+
+    /* The ids buffer limit is honoured */
+    if (count > 1)
+    {
+        TEST_CHECK(grid_query(x, y, width, height, mask, ids, 1) == 1,
+                   "query wrote more ids than allowed");
+    }
+}
+
+static void test_grid_limits(void)
+{
+    uint16_t i;
+
+    grid_clear();
+    TEST_CHECK(!grid_add(0, 10, 10, 0, 8, 1, 1), "empty box added");
+    for (i = 0; i < GRID_OBJECTS; ++i)
+    {
+        grid_add(i, 0, 0, 8, 8, 1, 1);
+    }
+    TEST_CHECK(!grid_add(i, 0, 0, 8, 8, 1, 1), "full grid added an object");
+
+    /* Boxes covering the whole grid run out of cell references */
+    grid_clear();
+    for (i = 0; i < GRID_ENTRIES / (GRID_COLS * GRID_ROWS); ++i)
+    {
+        TEST_CHECK(grid_add(i, -8, -8, 1024, 1024, 1, 1), "big box %u", i);
+    }
+    TEST_CHECK(!grid_add(i, -8, -8, 1024, 1024, 1, 1), "entries overflow");
+    grid_build();
+    TEST_CHECK(grid_pairs_find() == i * (i - 1) / 2, "big boxes pairs");
+}
+
+int main(void)
+{
+    uint16_t frame;
+    uint16_t i;
+
+    grid_init();
+    for (frame = 0; frame < TEST_GRID_FRAMES; ++frame)
+    {
+        test_grid_frame_build();
+        test_grid_pairs();
+        for (i = 0; i < 8; ++i)
+        {
+            test_grid_query();
+        }
+    }
+    test_grid_limits();
+
+    return test_report("grid");
+}
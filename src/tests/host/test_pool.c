@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * File: test_pool.c
+ * Object pool checks
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "test.h"
+#include "pool.h"
+
+#define TEST_POOL_SIZE 8
+
+typedef struct test_obj_t
+{
+    int16_t x;
+    int16_t y;
+} test_obj_t;
+
+POOL_DEFINE(test, test_obj_t, TEST_POOL_SIZE)
+POOL_DEFINE(one, test_obj_t, 1)
+
+static test_pool_t test_pool;
+static one_pool_t one_pool;
+
+/**
+ * @brief Counts the live objects walking the pool
+ *
+ * @return uint16_t Live objects found
+ */
+static uint16_t test_pool_walk(void)
+{
+    test_obj_t *obj;
+    test_obj_t *prev = NULL;
+    uint16_t count = 0;
+
+    for (obj = test_pool_first(&test_pool); obj;
+         obj = test_pool_next(&test_pool, obj))
+    {
+        TEST_CHECK(prev == NULL || obj > prev, "walk is not in memory order");
+        prev = obj;
+        ++count;
+    }
+    return count;
+}
+
+static void test_pool_alloc_free(void)
+{
+    test_obj_t *objs[TEST_POOL_SIZE];
+    uint16_t i;
+    uint16_t j;
+
+    test_pool_init(&test_pool);
+    TEST_CHECK(test_pool_count(&test_pool) == 0, "new pool is not empty");
+    TEST_CHECK(test_pool_first(&test_pool) == NULL, "new pool has objects");
+
+    for (i = 0; i < TEST_POOL_SIZE; ++i)
+    {
+        objs[i] = test_pool_alloc(&test_pool);
+        TEST_CHECK(objs[i] != NULL, "alloc %u failed", i);
+        objs[i]->x = i;
+        for (j = 0; j < i; ++j)
+        {
+            TEST_CHECK(objs[i] != objs[j], "alloc %u reused %u", i, j);
+        }
+    }
+    TEST_CHECK(test_pool_alloc(&test_pool) == NULL, "full pool allocated");
+    TEST_CHECK(test_pool_count(&test_pool) == TEST_POOL_SIZE,
+               "count %u, not %u", test_pool_count(&test_pool),
+               TEST_POOL_SIZE);
+    TEST_CHECK(test_pool_walk() == TEST_POOL_SIZE, "walk missed objects");
+
+    /* Free every other object, the walk skips them */
+    for (i = 0; i < TEST_POOL_SIZE; i += 2)
+    {
+        test_pool_free(&test_pool, objs[i]);
+    }
+    TEST_CHECK(test_pool_count(&test_pool) == TEST_POOL_SIZE / 2,
+               "count %u after freeing half", test_pool_count(&test_pool));
+    TEST_CHECK(test_pool_walk() == TEST_POOL_SIZE / 2, "walk found freed");
+    TEST_CHECK(test_pool_first(&test_pool) == objs[1], "first is not 1");
+    for (i = 1; i < TEST_POOL_SIZE; i += 2)
+    {
+        TEST_CHECK(objs[i]->x == i, "object %u was overwritten", i);
+    }
+
+    /* Freed slots are reused and there are no more than them */
+    for (i = 0; i < TEST_POOL_SIZE / 2; ++i)
+    {
+        TEST_CHECK(test_pool_alloc(&test_pool) != NULL, "realloc %u", i);
+    }
+    TEST_CHECK(test_pool_alloc(&test_pool) == NULL, "refilled pool allocated");
+
+    /* Init frees everything */
+    test_pool_init(&test_pool);
+    TEST_CHECK(test_pool_count(&test_pool) == 0, "init kept objects");
+    TEST_CHECK(test_pool_walk() == 0, "init kept live objects");
+}
+
+static void test_pool_double_free(void)
+{
+    test_obj_t *a;
+    test_obj_t *b;
+    test_obj_t *c;
+
+    test_pool_init(&test_pool);
+    a = test_pool_alloc(&test_pool);
+    b = test_pool_alloc(&test_pool);
+    test_pool_free(&test_pool, a);
+    test_pool_free(&test_pool, a);
+    TEST_CHECK(test_pool_count(&test_pool) == 1, "double free changed count");
+
+    /* A slot linked twice would be handed out twice */
+    a = test_pool_alloc(&test_pool);
+    c = test_pool_alloc(&test_pool);
+    TEST_CHECK(a != c && a != b && b != c, "double free duplicated a slot");
+    TEST_CHECK(test_pool_count(&test_pool) == 3, "count %u, not 3",
+               test_pool_count(&test_pool));
+}
+
+static void test_pool_single(void)
+{
+    test_obj_t *obj;
+
+    one_pool_init(&one_pool);
+    obj = one_pool_alloc(&one_pool);
+    TEST_CHECK(obj != NULL, "single slot pool alloc failed");
+    TEST_CHECK(one_pool_alloc(&one_pool) == NULL, "single slot pool overflow");
+    one_pool_free(&one_pool, obj);
+    TEST_CHECK(one_pool_alloc(&one_pool) == obj, "single slot not reused");
+}
+
+int main(void)
+{
+    test_pool_alloc_free();
+    test_pool_double_free();
+    test_pool_single();
+
+    return test_report("pool");
+}
@@ -10,6 +10,9 @@
 
 #include "text.h"
 
+/* Maximum number of digits of a 32 bits unsigned decimal number */
+#define TEXT_DEC_DIGITS     10
+
 static uint16_t text_base_tile;
 static uint16_t text_tileset_index;
 
@@ -65,3 +68,149 @@ uint16_t text_nrender(const char *str, uint16_t *dest, const uint16_t size)
 
     return size - i;
 }
+
+/**
+ * @brief Writes a decimal number with an optional sign and padding
+ *
+ * @param value Absolute value to write
+ * @param dest Destination buffer
+ * @param width Minimum number of cells to write
+ * @param pad Padding character
+ * @param sign Sign character or 0 for no sign
+ * @return uint16_t Total written cells (glyphs) in the buffer
+ */
+static uint16_t text_dec_render(uint32_t value, uint16_t *dest,
+                                const uint16_t width, const char pad,
+                                const char sign)
+{
+    /* Powers of ten for the subtraction based conversion */
+    static const uint32_t pow10[TEXT_DEC_DIGITS] =
+    {
+        1000000000, 100000000, 10000000, 1000000, 100000,
+        10000, 1000, 100, 10, 1
+    };
+    const uint32_t *pow;
+    uint16_t *start;
+    uint16_t base;
+    uint16_t digits;
+    uint16_t cells;
+    uint16_t digit;
+
+    base = text_base_tile + text_tileset_index - 32;
+    start = dest;
+
+    /* Skip the powers greater than the value, always keeping the units */
+    pow = pow10;
+    digits = TEXT_DEC_DIGITS;
+    while (digits > 1 && value < *pow)
+    {
+        ++pow;
+        --digits;
+    }
+
+    /* The sign goes before zeros padding and after spaces padding */
+    cells = sign ? digits + 1 : digits;
+    if (sign && pad == '0')
+    {
+        *dest++ = base + sign;
+    }
+    for (; cells < width; ++cells)
+    {
+        *dest++ = base + pad;
+    }
+    if (sign && pad != '0')
+    {
+        *dest++ = base + sign;
+    }
+
+    /* Each digit is the number of times its power fits in the value (0..9) */
+    for (; digits; --digits)
+    {
+        digit = '0';
+        while (value >= *pow)
+        {
+            value -= *pow;
+            ++digit;
+        }
+        *dest++ = base + digit;
+        ++pow;
+    }
+
+    return dest - start;
+}
+
+uint16_t text_uint_render(const uint32_t value, uint16_t *dest,
+                          const uint16_t width, const char pad)
+{
+    return text_dec_render(value, dest, width, pad, 0);
+}
+
+uint16_t text_int_render(const int32_t value, uint16_t *dest,
+                         const uint16_t width, const char pad)
+{
+    if (value < 0)
+    {
+        /* Unsigned negation, so INT32_MIN is right too */
+        return text_dec_render(-(uint32_t) value, dest, width, pad, '-');
+    }
+
+    return text_dec_render(value, dest, width, pad, 0);
+}
+
+uint16_t text_hex_render(const uint32_t value, uint16_t *dest,
+                         const uint16_t digits)
+{
+    static const char hex[16] =
+    {
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+    };
+    uint16_t base;
+    uint16_t i;
+
+    base = text_base_tile + text_tileset_index - 32;
+
+    /* Written from the last digit backwards */
+    dest += digits;
+    for (i = 0; i < digits; ++i)
+    {
+        *--dest = base + hex[(value >> (i << 2)) & 0x0F];
+    }
+
+    return digits;
+}
+
+uint16_t text_fix16_render(const fix16_t value, uint16_t *dest,
+                           const uint16_t width, const uint16_t decimals)
+{
+    uint32_t abs_value;
+    uint16_t count;
+    uint16_t base;
+    uint16_t frac;
+    uint32_t product;
+    uint16_t i;
+
+    /* Works with the absolute value, so -0.5 keeps its sign */
+    abs_value = value < 0 ? -(uint32_t) value : (uint32_t) value;
+    count = text_dec_render(abs_value >> 16, dest, width, ' ',
+                            value < 0 ? '-' : 0);
+    if (decimals == 0)
+    {
+        return count;
+    }
+
+    base = text_base_tile + text_tileset_index - 32;
+    dest += count;
+    *dest++ = base + '.';
+
+    /* Each decimal is the integer part of the fraction by 10 (16x16 MULU) */
+    frac = abs_value & 0xFFFF;
+    for (i = decimals; i; --i)
+    {
+        product = (uint32_t) frac * 10;
+        *dest++ = base + '0' + (product >> 16);
+        frac = product;
+    }
+
+    return count + 1 + decimals;
+}
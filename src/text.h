@@ -15,12 +15,20 @@
  *          @ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_
  *          `abcdefghijklmnopqrstuvwxyz{|}~␡
  *
+ * Numbers are written straight as font tiles, without any intermediate string.
+ * Decimal conversion uses a powers of ten subtraction table instead of DIVU
+ * (around 140 cycles per division), so HUD counters can be updated every frame.
+ *
+ * Usage example:
+ *  size = text_uint_render(score, text, 6, '0');
+ *  plane_hline_draw(PLANE_A, text, 2, 1, size, false);
  */
 
 #ifndef TEXT_H
 #define TEXT_H
 
 #include <stdint.h>
+#include "fix.h"
 
 /**
  * @brief Sets the font tileset starting index in VRAM
@@ -70,4 +78,74 @@ uint16_t text_render(const char *str, uint16_t *dest);
  */
 uint16_t text_nrender(const char *str, uint16_t *dest, const uint16_t size);
 
+/**
+ * @brief Writes an unsigned integer in decimal as font tiles in a buffer using
+ *        the current text configuration.
+ *
+ * @param value Value to write
+ * @param dest Destination buffer
+ * @param width Minimum number of cells to write, padded on the left
+ * @param pad Padding character, usually ' ' or '0'
+ * @return uint16_t Total written cells (glyphs) in the buffer
+ *
+ * @note Destination buffer must have space for the width or for 10 cells,
+ * whatever is greater. Numbers wider than width are not cut.
+ */
+uint16_t text_uint_render(const uint32_t value, uint16_t *dest,
+                          const uint16_t width, const char pad);
+
+/**
+ * @brief Writes a signed integer in decimal as font tiles in a buffer using
+ *        the current text configuration.
+ *
+ * Negative numbers have a '-' sign before the digits. With '0' padding the
+ * sign goes before the padding ("-0042"), otherwise after it ("  -42").
+ *
+ * @param value Value to write
+ * @param dest Destination buffer
+ * @param width Minimum number of cells to write (including the sign)
+ * @param pad Padding character, usually ' ' or '0'
+ * @return uint16_t Total written cells (glyphs) in the buffer
+ *
+ * @note Destination buffer must have space for the width or for 11 cells,
+ * whatever is greater.
+ */
+uint16_t text_int_render(const int32_t value, uint16_t *dest,
+                         const uint16_t width, const char pad);
+
+/**
+ * @brief Writes an unsigned integer in hexadecimal as font tiles in a buffer
+ *        using the current text configuration.
+ *
+ * @param value Value to write
+ * @param dest Destination buffer
+ * @param digits Number of hexadecimal digits to write (1..8), upper digits of
+ *        the value are not written
+ * @return uint16_t Total written cells (glyphs) in the buffer
+ *
+ * @note Uppercase letters are used, so it works with 64 glyph fonts
+ */
+uint16_t text_hex_render(const uint32_t value, uint16_t *dest,
+                         const uint16_t digits);
+
+/**
+ * @brief Writes a 16.16 fixed point value in decimal as font tiles in a buffer
+ *        using the current text configuration.
+ *
+ * The integer part is written like text_int_render with ' ' padding, followed
+ * by a '.' and the requested number of decimals.
+ *
+ * @param value Value to write
+ * @param dest Destination buffer
+ * @param width Minimum number of cells for the integer part and its sign
+ * @param decimals Number of decimals to write (0 writes no '.'), they are
+ *        truncated, not rounded
+ * @return uint16_t Total written cells (glyphs) in the buffer
+ *
+ * @note Decimals are got with a multiplication by 10 each (MULU), not with
+ * divisions
+ */
+uint16_t text_fix16_render(const fix16_t value, uint16_t *dest,
+                           const uint16_t width, const uint16_t decimals);
+
 #endif /* TEXT_H */
@@ -14,6 +14,9 @@
 /* Stores if the console is working in PAL mode */
 static uint8_t pal_mode_flag;
 
+/* Copy of the mode register 4, the VDP registers can't be read back */
+static uint8_t vid_mode_4;
+
 /* This flag is set when the vertical blank starts */
 volatile uint8_t vid_vblank_flag;
 
@@ -46,7 +49,8 @@ void vid_init(void)
     /* External interrupt off, V scroll, H scroll */
     *VDP_PORT_CTRL_W = VDP_REG_MODESET_3 | VID_VSCROLL_MODE | VID_HSCROLL_MODE;
     /* H40 cells mode, shadows and highlights off, interlace mode off */
-    *VDP_PORT_CTRL_W = VDP_REG_MODESET_4 | 0x81;
+    vid_mode_4 = 0x81;
+    *VDP_PORT_CTRL_W = VDP_REG_MODESET_4 | vid_mode_4;
     /* H Scroll table address (divided by 0x400 = rsifht 10) */
     *VDP_PORT_CTRL_W = VDP_REG_HSCROLL_ADDR | (VID_HSCROLL_TABLE_ADDR >> 10);
     /* Auto increment in bytes for the VDP's address reg after read or write */
@@ -141,3 +145,10 @@ inline void vid_autoinc_set(const uint8_t increment)
 {
     *VDP_PORT_CTRL_W = VDP_REG_AUTOINC | increment;
 }
+
+inline void vid_shadow_highlight_set(const bool enable)
+{
+    /* Change only the shadow/highlight bit (0x08), keep the other modes */
+    vid_mode_4 = (vid_mode_4 & ~0x08) | (enable ? 0x08 : 0x00);
+    *VDP_PORT_CTRL_W = VDP_REG_MODESET_4 | vid_mode_4;
+}
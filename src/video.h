@@ -32,6 +32,14 @@
 #define PLANE_B VID_PLANE_B_ADDR
 #define PLANE_W VID_PLANE_W_ADDR
 
+/*
+ * Shadow/highlight operator colors. In shadow/highlight mode, sprite pixels
+ * using these CRAM colors (palette 3, colors 14 and 15) are not drawn. Instead
+ * they highlight or shadow the pixels below them.
+ */
+#define VID_SH_HIGHLIGHT_INDEX  62
+#define VID_SH_SHADOW_INDEX     63
+
 /* Plane scroll modes (vscr | hscr1 | hscr0) */
 typedef enum vid_hscroll_mode
 {
@@ -142,13 +150,19 @@ void vid_plane_size_set(const vid_plane_size_t size);
  */
 void vid_autoinc_set(const uint8_t increment);
 
-
-/*
-    * TODO:
-    vid_hilightshadow_set
-
-*/
-
+/**
+ * @brief Enables or disables the shadow/highlight mode
+ * 
+ * In shadow/highlight mode, plane pixels are drawn shadowed (half bright)
+ * unless one of the planes has a high priority cell in that position. High
+ * priority sprites are drawn normally while low priority ones are shadowed
+ * like the planes below them. Sprite pixels using the operator colors (see
+ * VID_SH_HIGHLIGHT_INDEX and VID_SH_SHADOW_INDEX) highlight or shadow the
+ * pixels below them, so lighting and transparency effects come for free.
+ * 
+ * @param enable True to enable the shadow/highlight mode, false to disable it
+ */
+void vid_shadow_highlight_set(const bool enable);
 
 
 #endif /* VIDEO_H */
@@ -9,6 +9,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "ym2612.h"
 #include "z80.h"
 
@@ -26,6 +27,17 @@
 #define YM2612_FM2_PORT_ADDRESS ((volatile uint8_t *) 0xA04002)
 #define YM2612_FM2_PORT_DATA    ((volatile uint8_t *) 0xA04003)
 
+/* Channel registers range kept in the shadow */
+#define YM2612_SHADOW_FIRST     0x30
+#define YM2612_SHADOW_SIZE      (0xB7 - YM2612_SHADOW_FIRST + 1)
+/* Operator registers in a patch (0x30..0x90) */
+#define YM2612_PATCH_OP_REGS    7
+
+/* Shadow of the channel registers of each set (FM1 and FM2) */
+static uint8_t ym2612_shadow[2][YM2612_SHADOW_SIZE];
+/* Channels whose shadow matches the chip (bit n = channel n) */
+static uint8_t ym2612_shadow_valid;
+
 /**
  * @brief Waits the YM2112 to be ready to receive new data
  */
@@ -158,4 +170,145 @@ void ym2612_init(void)
     }
 
     z80_bus_release();
-}
\ No newline at end of file
+
+    /* The patch registers have not been written yet */
+    ym2612_shadow_valid = 0;
+}
+
+/**
+ * @brief Writes a register if it differs from the shadow
+ *
+ * Waits for the chip only once per register, before the address write.
+ *
+ * @param port Address port of the register set (data port is the next one)
+ * @param shadow Shadow of the register set
+ * @param reg Register index to write
+ * @param data Data to be written
+ * @param force Write even if it matches the shadow
+ */
+static inline void ym2612_shadow_write(volatile uint8_t *port, uint8_t *shadow,
+                                       const uint8_t reg, const uint8_t data,
+                                       const bool force)
+{
+    if (force || shadow[reg - YM2612_SHADOW_FIRST] != data)
+    {
+        shadow[reg - YM2612_SHADOW_FIRST] = data;
+        ym2612_wait();
+        port[0] = reg;
+        port[1] = data;
+    }
+}
+
+/**
+ * @brief Leaves the FM1 address port pointing to the DAC data register
+ *
+ * The XGM driver writes its PCM samples to the FM1 data port without setting
+ * the address again, so it must be 0x2A before releasing the z80 bus.
+ */
+static inline void ym2612_dac_addr_restore(void)
+{
+    ym2612_wait();
+    *YM2612_FM1_PORT_ADDRESS = 0x2A;
+}
+
+void ym2612_patch_load(const uint8_t channel, const ym2612_patch_t *patch)
+{
+    volatile uint8_t *port;
+    uint8_t *shadow;
+    const uint8_t *data;
+    uint8_t reg;
+    uint8_t pan;
+    uint8_t i;
+    bool force;
+
+    /* Channels 3..5 are in the FM2 set */
+    if (channel < 3)
+    {
+        port = YM2612_FM1_PORT_ADDRESS;
+        shadow = ym2612_shadow[0];
+        reg = channel;
+    }
+    else
+    {
+        port = YM2612_FM2_PORT_ADDRESS;
+        shadow = ym2612_shadow[1];
+        reg = channel - 3;
+    }
+    force = !(ym2612_shadow_valid & (1 << channel));
+    /* Unknown panning defaults to left and right */
+    pan = force ? 0xC0 : shadow[0xB4 + reg - YM2612_SHADOW_FIRST] & 0xC0;
+
+    z80_bus_request();
+
+    ym2612_shadow_write(port, shadow, 0xB0 + reg, patch->fb_alg, force);
+    ym2612_shadow_write(port, shadow, 0xB4 + reg, pan | patch->ams_fms, force);
+
+    /* Operator registers 0x30..0x90, operators are 4 registers apart */
+    data = patch->dt_mul;
+    reg += 0x30;
+    for (i = 0; i < YM2612_PATCH_OP_REGS; ++i)
+    {
+        ym2612_shadow_write(port, shadow, reg, data[0], force);
+        ym2612_shadow_write(port, shadow, reg + 4, data[1], force);
+        ym2612_shadow_write(port, shadow, reg + 8, data[2], force);
+        ym2612_shadow_write(port, shadow, reg + 12, data[3], force);
+        data += 4;
+        reg += 0x10;
+    }
+
+    ym2612_dac_addr_restore();
+    z80_bus_release();
+
+    ym2612_shadow_valid |= 1 << channel;
+}
+
+inline void ym2612_shadow_invalidate(const uint8_t channel)
+{
+    ym2612_shadow_valid &= ~(1 << channel);
+}
+
+void ym2612_freq_set(const uint8_t channel, const uint8_t block,
+                     const uint16_t fnum)
+{
+    volatile uint8_t *port;
+    uint8_t reg;
+
+    port = channel < 3 ? YM2612_FM1_PORT_ADDRESS : YM2612_FM2_PORT_ADDRESS;
+    reg = channel < 3 ? channel : channel - 3;
+
+    z80_bus_request();
+    /* The high part is latched until the low part is written */
+    ym2612_wait();
+    port[0] = 0xA4 + reg;
+    port[1] = (block << 3) | (fnum >> 8);
+    ym2612_wait();
+    port[0] = 0xA0 + reg;
+    port[1] = fnum;
+    ym2612_dac_addr_restore();
+    z80_bus_release();
+}
+
+/**
+ * @brief Writes the key on/off register of a channel
+ *
+ * @param channel FM channel [0..5]
+ * @param operators Operators on mask
+ */
+static void ym2612_key_write(const uint8_t channel, const uint8_t operators)
+{
+    /* Channels 3..5 are numbered 4..6 in the key register */
+    z80_bus_request();
+    ym2612_fm1_write(0x28, operators | (channel < 3 ? channel : channel + 1));
+    ym2612_dac_addr_restore();
+    z80_bus_release();
+}
+
+inline void ym2612_key_on(const uint8_t channel, const uint8_t operators)
+{
+    ym2612_key_write(channel, operators);
+}
+
+inline void ym2612_key_off(const uint8_t channel)
+{
+    ym2612_key_write(channel, 0x00);
+}
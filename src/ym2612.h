@@ -16,6 +16,16 @@
  *    One LFO (low frequency oscillator) to distort the FM sounds
  *    2 timers, for use by software 
  *
+ * Instruments are loaded with ym2612_patch_load. It keeps a RAM shadow of the
+ * channel registers, so only the registers which change are written, and it
+ * waits for the chip only once per register write, all in a single z80 bus
+ * request.
+ * The XGM driver also writes the YM2612, so the shadow of a channel used by
+ * the music must be invalidated with ym2612_shadow_invalidate before loading
+ * a patch on it from the m68k. The XGM driver also expects the FM1 address port
+ * to stay on the DAC register, so these functions set it back to 0x2A before
+ * releasing the z80 bus.
+ *
  * More info:
  * https://www.smspower.org/maxim/Documents/YM2612
  * https://www.chibiakumas.com/68000/platform3.php
@@ -25,6 +35,36 @@
 #ifndef YM2612_H
 #define YM2612_H
 
+#include <stdint.h>
+
+/* Number of FM channels */
+#define YM2612_CHANNELS 6
+
+/* Operator masks for ym2612_key_on */
+#define YM2612_OP1      0x10
+#define YM2612_OP2      0x20
+#define YM2612_OP3      0x40
+#define YM2612_OP4      0x80
+#define YM2612_OP_ALL   0xF0
+
+/*
+ * FM instrument patch
+ * Fields have the layout of the YM2612 registers, and the four values of each
+ * operator register are in register order (operators 1, 3, 2 and 4).
+ */
+typedef struct ym2612_patch_t
+{
+    uint8_t fb_alg;         /* 0xB0: Feedback (bits 5-3) and algorithm (2-0) */
+    uint8_t ams_fms;        /* 0xB4: AMS (bits 5-4) and FMS (2-0) */
+    uint8_t dt_mul[4];      /* 0x30: Detune (bits 6-4) and multiple (3-0) */
+    uint8_t tl[4];          /* 0x40: Total level (bits 6-0) */
+    uint8_t rs_ar[4];       /* 0x50: Rate scaling (bits 7-6), attack (4-0) */
+    uint8_t am_d1r[4];      /* 0x60: AM enable (bit 7), decay rate (4-0) */
+    uint8_t d2r[4];         /* 0x70: Sustain rate (bits 4-0) */
+    uint8_t d1l_rr[4];      /* 0x80: Sustain level (bits 7-4), release (3-0) */
+    uint8_t ssg_eg[4];      /* 0x90: SSG-EG (bits 3-0) */
+} ym2612_patch_t;
+
 /**
  * @brief initialises the YM2612 sound hardware.
  * 
@@ -35,4 +75,52 @@
  */
 void ym2612_init(void);
 
+/**
+ * @brief Loads an instrument patch in a FM channel
+ * 
+ * Only the registers which differ from the shadow are written. The channel
+ * panning is kept.
+ * 
+ * @param channel FM channel [0..5]
+ * @param patch Instrument patch
+ * 
+ * @note Key off the channel before changing its patch to avoid clicks
+ */
+void ym2612_patch_load(const uint8_t channel, const ym2612_patch_t *patch);
+
+/**
+ * @brief Forgets the shadow of a channel
+ * 
+ * The next patch loaded in the channel writes all its registers. Use it when
+ * the XGM driver could have changed the channel.
+ * 
+ * @param channel FM channel [0..5]
+ */
+void ym2612_shadow_invalidate(const uint8_t channel);
+
+/**
+ * @brief Sets the frequency of a FM channel
+ * 
+ * @param channel FM channel [0..5]
+ * @param block Octave block [0..7]
+ * @param fnum Frequency number [0..2047]
+ */
+void ym2612_freq_set(const uint8_t channel, const uint8_t block,
+                     const uint16_t fnum);
+
+/**
+ * @brief Keys on the operators of a FM channel
+ * 
+ * @param channel FM channel [0..5]
+ * @param operators Operators to key on (YM2612_OP1 | ... or YM2612_OP_ALL)
+ */
+void ym2612_key_on(const uint8_t channel, const uint8_t operators);
+
+/**
+ * @brief Keys off all the operators of a FM channel
+ * 
+ * @param channel FM channel [0..5]
+ */
+void ym2612_key_off(const uint8_t channel);
+
 #endif /* YM2612_H */
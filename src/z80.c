@@ -9,6 +9,8 @@
  */
 
 #include "z80.h"
+#include "vdp.h"
+#include "kdebug.h"
 
 /* Z80 control ports */
 #define Z80_BUS_PORT    ((volatile uint16_t *) 0xA11100)
@@ -18,6 +20,190 @@
 #define Z80_RAM_ADDRESS     ((uint8_t *) 0xA00000)
 #define Z80_RAM_SIZE        0x2000;
 
+#ifdef NDEBUG
+
+#define z80_prof_start() ((void)0)
+#define z80_prof_stop() ((void)0)
+
+#else
+
+/*
+ * Maximum nesting of bus requests: main code, the VBlank handler and raster
+ * callbacks in the HBlank handler
+ */
+#define Z80_PROF_DEPTH  3
+
+/* Call site of the next bus request and the one it replaced */
+static uint8_t z80_prof_site;
+static uint8_t z80_prof_site_prev;
+/*
+ * Requests being measured. An interrupt can request the bus while the main
+ * code holds it, so the outer request is paused until the inner one ends
+ */
+static uint8_t z80_prof_depth;
+static uint8_t z80_prof_held_sites[Z80_PROF_DEPTH];
+static uint8_t z80_prof_held_prev[Z80_PROF_DEPTH];
+/* HV counter value when the innermost request started or resumed */
+static uint16_t z80_prof_hv;
+/* Stats of the current frame */
+static uint16_t z80_prof_requests[Z80_PROF_SITES];
+static uint32_t z80_prof_held_time[Z80_PROF_SITES];
+/* Stats of the last frame */
+static uint16_t z80_prof_last_requests[Z80_PROF_SITES];
+static uint32_t z80_prof_last_held_time[Z80_PROF_SITES];
+/* Worst time held in a frame */
+static uint32_t z80_prof_peak_held_time[Z80_PROF_SITES];
+
+static const char *const z80_prof_names[Z80_PROF_SITES] = {
+    "OTHER", "DMA  ", "SOUND", "PAD  "
+};
+
+/**
+ * @brief Starts measuring a bus request
+ * 
+ * If there is a request already being measured (an interrupt requested the bus
+ * while the main code had it), its time is paused and charged to its own site.
+ */
+static inline void z80_prof_start(void)
+{
+    uint16_t hv = *VDP_PORT_HV_COUNTER;
+
+    if (z80_prof_depth > 0)
+    {
+        /* V counter in the high byte, so one scanline is 256 units */
+        z80_prof_held_time[z80_prof_held_sites[z80_prof_depth - 1]] +=
+            (uint16_t) (hv - z80_prof_hv);
+    }
+    if (z80_prof_depth < Z80_PROF_DEPTH)
+    {
+        z80_prof_held_sites[z80_prof_depth] = z80_prof_site;
+        z80_prof_held_prev[z80_prof_depth] = z80_prof_site_prev;
+        ++z80_prof_depth;
+        ++z80_prof_requests[z80_prof_site];
+    }
+    z80_prof_hv = hv;
+    z80_prof_site = Z80_PROF_OTHER;
+    z80_prof_site_prev = Z80_PROF_OTHER;
+}
+
+/**
+ * @brief Stops measuring a bus request and accumulates the time held
+ * 
+ * The paused outer request, if any, resumes. The site set by the code that was
+ * interrupted before its request is restored.
+ */
+static inline void z80_prof_stop(void)
+{
+    uint16_t hv;
+
+    if (z80_prof_depth > 0)
+    {
+        hv = *VDP_PORT_HV_COUNTER;
+        --z80_prof_depth;
+        z80_prof_held_time[z80_prof_held_sites[z80_prof_depth]] +=
+            (uint16_t) (hv - z80_prof_hv);
+        z80_prof_site = z80_prof_held_prev[z80_prof_depth];
+        z80_prof_hv = hv;
+    }
+}
+
+/**
+ * @brief Writes a number in hexadecimal
+ * 
+ * @param dest Destination string
+ * @param value Value to write
+ * @param digits Number of digits to write
+ * @return char* Position after the last digit written
+ */
+static char *z80_prof_hex(char *dest, uint32_t value, uint8_t digits)
+{
+    uint8_t nibble;
+
+    dest += digits;
+    while (digits--)
+    {
+        nibble = value & 0x0F;
+        *--dest = nibble < 10 ? '0' + nibble : 'A' - 10 + nibble;
+        value >>= 4;
+    }
+
+    return dest;
+}
+
+inline void __z80_prof_site_set(const uint8_t site)
+{
+    z80_prof_site_prev = z80_prof_site;
+    z80_prof_site = site;
+}
+
+void __z80_prof_frame(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < Z80_PROF_SITES; ++i)
+    {
+        z80_prof_last_requests[i] = z80_prof_requests[i];
+        z80_prof_last_held_time[i] = z80_prof_held_time[i];
+        if (z80_prof_held_time[i] > z80_prof_peak_held_time[i])
+        {
+            z80_prof_peak_held_time[i] = z80_prof_held_time[i];
+        }
+        z80_prof_requests[i] = 0;
+        z80_prof_held_time[i] = 0;
+    }
+}
+
+void __z80_prof_report(void)
+{
+    /* "Z80 SSSSS REQ:XXXX HELD:XXXXXX PEAK:XXXXXX" */
+    char line[44];
+    char *c;
+    const char *name;
+    uint8_t i;
+
+    for (i = 0; i < Z80_PROF_SITES; ++i)
+    {
+        c = line;
+        *c++ = 'Z';
+        *c++ = '8';
+        *c++ = '0';
+        *c++ = ' ';
+        for (name = z80_prof_names[i]; *name; ++name)
+        {
+            *c++ = *name;
+        }
+        for (name = " REQ:"; *name; ++name)
+        {
+            *c++ = *name;
+        }
+        c = z80_prof_hex(c, z80_prof_last_requests[i], 4);
+        for (name = " HELD:"; *name; ++name)
+        {
+            *c++ = *name;
+        }
+        c = z80_prof_hex(c, z80_prof_last_held_time[i], 6);
+        for (name = " PEAK:"; *name; ++name)
+        {
+            *c++ = *name;
+        }
+        c = z80_prof_hex(c, z80_prof_peak_held_time[i], 6);
+        *c = '\0';
+        kdebug_alert(line);
+    }
+}
+
+inline uint16_t __z80_prof_requests_get(const uint8_t site)
+{
+    return z80_prof_last_requests[site];
+}
+
+inline uint32_t __z80_prof_held_get(const uint8_t site)
+{
+    return z80_prof_last_held_time[site];
+}
+
+#endif
+
 static void z80_ram_clear(void)
 {
     /* We need a 0 byte, not a word */
@@ -60,6 +246,7 @@ void z80_reset(void)
 
 void z80_bus_request(void)
 {
+    z80_prof_start();
     /* Request the bus */
     *Z80_BUS_PORT = 0x100;
     /* If there is a reset process, force it to end now */
@@ -72,12 +259,14 @@ void z80_bus_request(void)
 
 inline void z80_bus_request_fast(void)
 {
+    z80_prof_start();
     *Z80_BUS_PORT = 0x100;
 }
 
 inline void z80_bus_release(void)
 {
     *Z80_BUS_PORT = 0x000;
+    z80_prof_stop();
 }
 
 bool z80_is_bus_free(void)
@@ -10,6 +10,25 @@
  * The secondary Z80 CPU in the Sega Megadrive/Genesis, is used to handle the
  * sound hardware and releasing the m68k from these tasks.
  *
+ * While the m68k holds the z80 bus the z80 is stopped, so the XGM driver can't
+ * feed the PCM channels. In debug builds (NDEBUG not defined) every bus request
+ * is profiled: requests and time held (measured with the HV counter) are
+ * accumulated per call site and can be reported through kdebug. When an
+ * interrupt requests the bus while the main code holds it, the time is charged
+ * to the interrupt's site and the main code's request goes on afterwards.
+ *
+ * Profiler usage example:
+ *  while (1)
+ *  {
+ *      ...
+ *      vid_vsync_wait();
+ *      z80_prof_frame();
+ *      if (pad_btn_pressed(PAD_1, PAD_BTN_START))
+ *      {
+ *          z80_prof_report();
+ *      }
+ *  }
+ *
  * More info:
  * https://www.plutiedev.com/using-the-z80
  */
@@ -20,6 +39,77 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+/* Bus request call sites tracked by the profiler */
+#define Z80_PROF_OTHER      0
+#define Z80_PROF_DMA        1
+#define Z80_PROF_SOUND      2
+#define Z80_PROF_PAD        3
+#define Z80_PROF_SITES      4
+
+/* Profiling disabled so do not evaluate profiler functions. */
+#ifdef NDEBUG
+
+#define z80_prof_site_set(x) ((void)0)
+#define z80_prof_frame() ((void)0)
+#define z80_prof_report() ((void)0)
+#define z80_prof_requests_get(x) (0)
+#define z80_prof_held_get(x) (0)
+
+#else
+
+#define z80_prof_site_set(x) __z80_prof_site_set(x)
+#define z80_prof_frame() __z80_prof_frame()
+#define z80_prof_report() __z80_prof_report()
+#define z80_prof_requests_get(x) __z80_prof_requests_get(x)
+#define z80_prof_held_get(x) __z80_prof_held_get(x)
+
+/**
+ * @brief Sets the call site of the next bus request
+ * 
+ * The site is used until the bus is released, then it goes back to
+ * Z80_PROF_OTHER.
+ * 
+ * @param site Call site (Z80_PROF_DMA, Z80_PROF_SOUND, ...)
+ */
+void __z80_prof_site_set(const uint8_t site);
+
+/**
+ * @brief Closes the current profiling frame
+ * 
+ * Stores the counters of the frame, so they can be read with the getters, and
+ * starts a new one. Call it once per frame, i.e. after vid_vsync_wait.
+ */
+void __z80_prof_frame(void);
+
+/**
+ * @brief Outputs the last frame stats on the emulator's Message window
+ * 
+ * Shows one line per call site with the bus requests and the time held in the
+ * last frame, and the worst time held in a frame since the start.
+ */
+void __z80_prof_report(void);
+
+/**
+ * @brief Gets the number of bus requests of a call site in the last frame
+ * 
+ * @param site Call site
+ * @return uint16_t Number of bus requests
+ */
+uint16_t __z80_prof_requests_get(const uint8_t site);
+
+/**
+ * @brief Gets the time a call site held the bus in the last frame
+ * 
+ * The time is measured with the HV counter in 1/256 scanline units, so a
+ * scanline is 256 units. The H counter is not linear, so it is an estimation.
+ * 
+ * @param site Call site
+ * @return uint32_t Time held in 1/256 scanline units
+ */
+uint32_t __z80_prof_held_get(const uint8_t site);
+
+#endif
+
 /**
  * @brief initialises the z80 CPU.
  * 
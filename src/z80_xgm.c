@@ -0,0 +1,513 @@
+#include "z80_xgm.h"
+
+const uint8_t z80_xgm[Z80_XGM_SIZE] = {
+    0xF3, 0x31, 0x00, 0x16, 0xED, 0x56, 0xAF, 0x32, 0x02, 0x01, 0x32, 0x00, 
+    0x01, 0xC3, 0x00, 0x17, 0x31, 0x00, 0x16, 0x13, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0xAF, 0x32, 0x97, 0x01, 0x32, 0x98, 0x01, 0x94, 0x9F, 
+    0xB1, 0x4F, 0x32, 0x99, 0x01, 0x3E, 0x07, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 
+    0x00, 0x3A, 0x02, 0x01, 0xA1, 0xE6, 0x40, 0xCA, 0x72, 0x00, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 0xA4, 0x01, 0xED, 0x5B, 0x9E, 0x01, 
+    0x19, 0x9F, 0x4F, 0x3A, 0x9D, 0x01, 0x47, 0x94, 0x9F, 0xA1, 0x4F, 0x7C, 
+    0x90, 0x9F, 0x5F, 0xA9, 0x4F, 0x7A, 0x17, 0x9F, 0xA1, 0xAB, 0x32, 0x99, 
+    0x01, 0x4F, 0xA5, 0x6F, 0x7C, 0xA8, 0xA1, 0xA8, 0x67, 0x22, 0xA4, 0x01, 
+    0xED, 0x4F, 0xED, 0x4F, 0x3E, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 
+    0xD9, 0x3A, 0xA5, 0x01, 0x4F, 0x21, 0x9B, 0x01, 0x86, 0x47, 0x87, 0x9F, 
+    0xB0, 0xCB, 0xBF, 0x2E, 0xA6, 0x47, 0x96, 0x70, 0xC6, 0xFF, 0x9F, 0x47, 
+    0x2E, 0x9A, 0x7E, 0xEE, 0x20, 0xA0, 0xAE, 0x77, 0x2E, 0x9C, 0x7E, 0x81, 
+    0x47, 0xCB, 0x3F, 0x80, 0x1F, 0xCB, 0x3F, 0x2E, 0xA7, 0xBE, 0x77, 0x00, 
+    0xCA, 0xCB, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x11, 0x00, 
+    0x17, 0x3A, 0x02, 0x01, 0xE6, 0x40, 0x00, 0xCA, 0x60, 0x11, 0x11, 0x5C, 
+    0x01, 0xCD, 0xEC, 0x14, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xD9, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x11, 0x00, 0x17, 0x21, 0x9A, 0x01, 
+    0x7E, 0xD6, 0x08, 0xDA, 0x60, 0x11, 0x77, 0x2E, 0xA8, 0x7E, 0x6F, 0xC6, 
+    0x08, 0xCB, 0xAF, 0x32, 0xA8, 0x01, 0x26, 0x01, 0x3A, 0xA6, 0x01, 0x47, 
+    0x0E, 0x08, 0xDD, 0x21, 0x36, 0x11, 0x3E, 0x04, 0x3D, 0x20, 0xFD, 0xC3, 
+    0x3C, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0x11, 0x00, 0x17, 0x3A, 0x02, 0x01, 0xCB, 0x77, 0xC2, 
+    0x1B, 0x02, 0x3E, 0x09, 0x3D, 0x20, 0xFD, 0xAF, 0xC3, 0x29, 0x04, 0x2A, 
+    0x34, 0x01, 0x7C, 0x17, 0x3A, 0x36, 0x01, 0x17, 0x01, 0x00, 0x60, 0x02, 
+    0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 
+    0x0F, 0x02, 0xAF, 0x02, 0x7C, 0xCB, 0xFC, 0x06, 0x00, 0x4E, 0x67, 0xD9, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x7D, 0x81, 0x32, 0x34, 0x01, 0x38, 
+    0x1A, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0xCB, 
+    0xFC, 0x23, 0xAF, 0xFD, 0x67, 0x00, 0x0D, 0xCA, 0x46, 0x03, 0x18, 0x00, 
+    0xC3, 0xA5, 0x02, 0xFD, 0x67, 0x91, 0xED, 0x44, 0x3D, 0xC2, 0x8B, 0x02, 
+    0x7C, 0xC6, 0x01, 0x32, 0x35, 0x01, 0x3A, 0x36, 0x01, 0x88, 0x32, 0x36, 
+    0x01, 0xCB, 0xFC, 0x23, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 
+    0xC3, 0x46, 0x03, 0x4F, 0x7C, 0xC6, 0x01, 0x32, 0x35, 0x01, 0x3A, 0x36, 
+    0x01, 0x88, 0x32, 0x36, 0x01, 0xCB, 0xFC, 0x23, 0x3E, 0x03, 0x3D, 0x20, 
+    0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x3E, 0x0B, 0xB9, 0xD2, 0xD1, 0x02, 0xD9, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 
+    0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 
+    0xED, 0xA0, 0xED, 0xA0, 0xC3, 0xCB, 0x02, 0x3E, 0x0B, 0xB9, 0xDA, 0xAB, 
+    0x02, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0xA0, 0xE2, 0x25, 
+    0x03, 0xED, 0xA0, 0xE2, 0x2B, 0x03, 0xED, 0xA0, 0xE2, 0x31, 0x03, 0xED, 
+    0xA0, 0xE2, 0x37, 0x03, 0xED, 0xA0, 0xE2, 0x3D, 0x03, 0xED, 0xA0, 0xE2, 
+    0x43, 0x03, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x00, 
+    0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0xA0, 0xE2, 0x25, 0x03, 
+    0xED, 0xA0, 0xE2, 0x2B, 0x03, 0xED, 0xA0, 0xE2, 0x31, 0x03, 0xED, 0xA0, 
+    0xE2, 0x37, 0x03, 0xED, 0xA0, 0xE2, 0x3D, 0x03, 0xED, 0xA0, 0xC3, 0x43, 
+    0x03, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0x00, 0xFD, 
+    0x7C, 0xB7, 0xCA, 0x29, 0x04, 0xC3, 0x50, 0x03, 0x3E, 0x00, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 0x34, 0x01, 0x7C, 0x17, 0x3A, 0x36, 
+    0x01, 0x17, 0x01, 0x00, 0x60, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 
+    0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0x0F, 0x02, 0xAF, 0x02, 0xCB, 0xFC, 
+    0x2E, 0x00, 0x18, 0x00, 0xED, 0x4F, 0x06, 0x00, 0xFD, 0x4C, 0x3E, 0x0B, 
+    0xB9, 0xD2, 0xAE, 0x03, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xC3, 0xA8, 0x03, 
+    0x3E, 0x0B, 0xB9, 0xDA, 0x88, 0x03, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 
+    0xD9, 0xED, 0xA0, 0xE2, 0x02, 0x04, 0xED, 0xA0, 0xE2, 0x08, 0x04, 0xED, 
+    0xA0, 0xE2, 0x0E, 0x04, 0xED, 0xA0, 0xE2, 0x14, 0x04, 0xED, 0xA0, 0xE2, 
+    0x1A, 0x04, 0xED, 0xA0, 0xE2, 0x20, 0x04, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 
+    0xED, 0x4F, 0xED, 0x4F, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 
+    0xED, 0xA0, 0xE2, 0x02, 0x04, 0xED, 0xA0, 0xE2, 0x08, 0x04, 0xED, 0xA0, 
+    0xE2, 0x0E, 0x04, 0xED, 0xA0, 0xE2, 0x14, 0x04, 0xED, 0xA0, 0xE2, 0x1A, 
+    0x04, 0xED, 0xA0, 0xC3, 0x20, 0x04, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 
+    0x18, 0x00, 0xED, 0x4F, 0x3E, 0x00, 0x3E, 0x00, 0xAF, 0x12, 0xC3, 0x2D, 
+    0x04, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3A, 0x02, 0x01, 0xCB, 
+    0x77, 0xC2, 0x48, 0x04, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x18, 0x00, 0xED, 
+    0x4F, 0xC3, 0x59, 0x04, 0x21, 0x94, 0x01, 0x7E, 0xC6, 0x01, 0x77, 0x2C, 
+    0x7E, 0xCE, 0x00, 0x77, 0x2C, 0x7E, 0xCE, 0x00, 0x77, 0x3E, 0x03, 0x3D, 
+    0x20, 0xFD, 0xC3, 0x61, 0x04, 0xED, 0x5B, 0x38, 0x01, 0xD9, 0x78, 0xD9, 
+    0xBA, 0xCA, 0x3E, 0x09, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 
+    0x16, 0x01, 0x7D, 0x17, 0x7C, 0x17, 0x11, 0x00, 0x60, 0x12, 0x0F, 0x12, 
+    0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 
+    0xAF, 0x12, 0x65, 0xCB, 0xFC, 0x2E, 0x00, 0xED, 0x5B, 0x38, 0x01, 0x01, 
+    0xF2, 0x00, 0x3E, 0x00, 0x00, 0xED, 0x4F, 0x18, 0x00, 0xD9, 0x0A, 0x03, 
+    0xCB, 0x90, 0x12, 0xD9, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 
+    0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 
+    0xED, 0xA0, 0x00, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xEA, 0xA1, 0x04, 
+    0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0xA0, 0xED, 0xA0, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 
+    0xA0, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0x4F, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 
+    0x12, 0xD9, 0xED, 0xA0, 0xED, 0xA0, 0xED, 0xA0, 0x2A, 0x16, 0x01, 0x23, 
+    0x22, 0x16, 0x01, 0x2A, 0x18, 0x01, 0x2B, 0x7C, 0xB5, 0xCA, 0x2D, 0x05, 
+    0x22, 0x18, 0x01, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0x00, 0xC3, 0x3D, 0x05, 0x2A, 0x00, 0x1C, 0x22, 0x16, 0x01, 0x21, 
+    0x01, 0x00, 0x22, 0x18, 0x01, 0xAF, 0x32, 0x14, 0x01, 0x00, 0x00, 0xD9, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 0x1E, 0x01, 0x7D, 0x17, 0x7C, 
+    0x17, 0x11, 0x00, 0x60, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 
+    0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0xAF, 0x12, 0x65, 0xCB, 0xFC, 
+    0x2E, 0x00, 0xF9, 0x2A, 0x38, 0x01, 0x01, 0x80, 0x10, 0xED, 0x4F, 0xED, 
+    0x4F, 0x00, 0xD1, 0xD9, 0x0A, 0x03, 0x12, 0xCB, 0x90, 0xD9, 0x7B, 0x86, 
+    0xE2, 0x82, 0x05, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0x8C, 
+    0x05, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x97, 0x05, 
+    0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xA1, 0x05, 0x79, 0xCE, 
+    0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0xAC, 0x05, 0x79, 0xCE, 0xFF, 
+    0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xB6, 0x05, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 
+    0xD9, 0x0A, 0x12, 0x03, 0xCB, 0x90, 0xD9, 0xD1, 0x7B, 0x86, 0xE2, 0xC8, 
+    0x05, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xD2, 0x05, 0x79, 
+    0xCE, 0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0xDD, 0x05, 0x79, 0xCE, 
+    0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xE7, 0x05, 0x79, 0xCE, 0xFF, 0x77, 
+    0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0xF2, 0x05, 0x79, 0xCE, 0xFF, 0x77, 0xD9, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2C, 0x7A, 0x86, 0xE2, 0x03, 0x06, 
+    0x79, 0xCE, 0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x0E, 0x06, 0x79, 
+    0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0x18, 0x06, 0x79, 0xCE, 0xFF, 
+    0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x23, 0x06, 0x79, 0xCE, 0xFF, 0x77, 
+    0x2C, 0x7A, 0x86, 0xE2, 0x2D, 0x06, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x05, 
+    0xC2, 0x72, 0x05, 0x00, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 
+    0x2A, 0x1E, 0x01, 0x23, 0x22, 0x1E, 0x01, 0x2A, 0x20, 0x01, 0x2B, 0x7C, 
+    0xB5, 0xCA, 0x5D, 0x06, 0x22, 0x20, 0x01, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0xC3, 0x6D, 0x06, 0x2A, 0x00, 0x1C, 
+    0x22, 0x1E, 0x01, 0x21, 0x01, 0x00, 0x22, 0x20, 0x01, 0xAF, 0x32, 0x1C, 
+    0x01, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 0x26, 0x01, 0x7D, 0x17, 0x7C, 0x17, 
+    0x11, 0x00, 0x60, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 
+    0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0xAF, 0x12, 0x65, 0xCB, 0xFC, 0x2E, 
+    0x00, 0xF9, 0x2A, 0x38, 0x01, 0x01, 0x80, 0x10, 0xED, 0x4F, 0xED, 0x4F, 
+    0x00, 0xD1, 0xD9, 0x0A, 0x03, 0x12, 0xCB, 0x90, 0xD9, 0x7B, 0x86, 0xE2, 
+    0xB9, 0x06, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xC3, 0x06, 
+    0x79, 0xCE, 0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0xCE, 0x06, 0x79, 
+    0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0xD8, 0x06, 0x79, 0xCE, 0xFF, 
+    0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0xE3, 0x06, 0x79, 0xCE, 0xFF, 0x77, 
+    0x2C, 0x7A, 0x86, 0xE2, 0xED, 0x06, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0xD9, 
+    0x0A, 0x12, 0x03, 0xCB, 0x90, 0xD9, 0xD1, 0x7B, 0x86, 0xE2, 0xFF, 0x06, 
+    0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0x09, 0x07, 0x79, 0xCE, 
+    0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x14, 0x07, 0x79, 0xCE, 0xFF, 
+    0x77, 0x2C, 0x7A, 0x86, 0xE2, 0x1E, 0x07, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 
+    0xD1, 0x7B, 0x86, 0xE2, 0x29, 0x07, 0x79, 0xCE, 0xFF, 0x77, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2C, 0x7A, 0x86, 0xE2, 0x3A, 0x07, 0x79, 
+    0xCE, 0xFF, 0x77, 0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x45, 0x07, 0x79, 0xCE, 
+    0xFF, 0x77, 0x2C, 0x7A, 0x86, 0xE2, 0x4F, 0x07, 0x79, 0xCE, 0xFF, 0x77, 
+    0x2C, 0xD1, 0x7B, 0x86, 0xE2, 0x5A, 0x07, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 
+    0x7A, 0x86, 0xE2, 0x64, 0x07, 0x79, 0xCE, 0xFF, 0x77, 0x2C, 0x05, 0xC2, 
+    0xA9, 0x06, 0x00, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 
+    0x26, 0x01, 0x23, 0x22, 0x26, 0x01, 0x2A, 0x28, 0x01, 0x2B, 0x7C, 0xB5, 
+    0xCA, 0x94, 0x07, 0x22, 0x28, 0x01, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 
+    0xED, 0x4F, 0xED, 0x4F, 0x00, 0xC3, 0xA4, 0x07, 0x2A, 0x00, 0x1C, 0x22, 
+    0x26, 0x01, 0x21, 0x01, 0x00, 0x22, 0x28, 0x01, 0xAF, 0x32, 0x24, 0x01, 
+    0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0xD9, 0x0A, 0x03, 
+    0xCB, 0x90, 0x12, 0xD9, 0x2A, 0x2E, 0x01, 0x7D, 0x17, 0x7C, 0x17, 0x11, 
+    0x00, 0x60, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 0x12, 0x0F, 
+    0x12, 0x0F, 0x12, 0x0F, 0x12, 0xAF, 0x12, 0x65, 0xCB, 0xFC, 0x2E, 0x00, 
+    0xED, 0x5B, 0x38, 0x01, 0x01, 0x80, 0x1C, 0x3E, 0x00, 0x00, 0xED, 0x4F, 
+    0x18, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 0x86, 0xE2, 
+    0xF1, 0x07, 0x79, 0xCE, 0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 
+    0xFD, 0x07, 0x79, 0xCE, 0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 
+    0x09, 0x08, 0x79, 0xCE, 0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 
+    0x15, 0x08, 0x79, 0xCE, 0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 
+    0x21, 0x08, 0x79, 0xCE, 0xFF, 0x81, 0x12, 0x00, 0xD9, 0x0A, 0x03, 0x12, 
+    0xCB, 0x90, 0xD9, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x35, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x41, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x4D, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x59, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x00, 0x05, 0xC2, 0xE2, 0x07, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 0x86, 0xE2, 0x71, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x7D, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x89, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x1A, 0x86, 0xE2, 0x95, 0x08, 0x79, 0xCE, 
+    0xFF, 0x81, 0x12, 0x1C, 0x2C, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x2A, 0x2E, 0x01, 0x23, 0x22, 0x2E, 0x01, 
+    0x2A, 0x30, 0x01, 0x2B, 0x7C, 0xB5, 0xCA, 0xC6, 0x08, 0x22, 0x30, 0x01, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0xC3, 
+    0xD6, 0x08, 0x2A, 0x00, 0x1C, 0x22, 0x2E, 0x01, 0x21, 0x01, 0x00, 0x22, 
+    0x30, 0x01, 0xAF, 0x32, 0x2C, 0x01, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x00, 
+    0x00, 0x3E, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3A, 0x02, 
+    0x01, 0x21, 0x00, 0x40, 0x36, 0x2B, 0x2C, 0xE6, 0x0F, 0xC2, 0x04, 0x09, 
+    0x3A, 0x61, 0x01, 0xB7, 0xCA, 0x15, 0x09, 0x3D, 0x32, 0x61, 0x01, 0x3E, 
+    0x80, 0xC3, 0x1C, 0x09, 0x3E, 0x00, 0x3E, 0x03, 0x32, 0x61, 0x01, 0xC3, 
+    0x0E, 0x09, 0x3E, 0x00, 0x3E, 0x80, 0xC3, 0x1C, 0x09, 0x18, 0x00, 0xED, 
+    0x4F, 0x3A, 0x60, 0x01, 0x77, 0x2D, 0xD9, 0x78, 0x32, 0x3B, 0x01, 0xD9, 
+    0xBA, 0x36, 0x2A, 0xCA, 0x34, 0x09, 0x14, 0xCB, 0x92, 0xED, 0x53, 0x38, 
+    0x01, 0xC3, 0x3E, 0x09, 0x14, 0xCB, 0x92, 0xED, 0x53, 0x38, 0x01, 0xC3, 
+    0x6C, 0x04, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3E, 0x03, 0x3D, 
+    0x20, 0xFD, 0x18, 0x00, 0x2A, 0x80, 0x01, 0x23, 0x22, 0x80, 0x01, 0x3A, 
+    0x13, 0x01, 0xB7, 0xC2, 0x82, 0x09, 0x3A, 0x11, 0x01, 0xB7, 0xC2, 0x72, 
+    0x09, 0xD9, 0x78, 0x32, 0x3B, 0x01, 0xD9, 0xC6, 0x01, 0xCB, 0x97, 0xBA, 
+    0xCA, 0x7F, 0x09, 0xC3, 0x3E, 0x09, 0x2A, 0x82, 0x01, 0x23, 0x22, 0x82, 
+    0x01, 0x18, 0x00, 0x00, 0xC3, 0x3E, 0x09, 0xC3, 0x6C, 0x04, 0x32, 0xA0, 
+    0x01, 0x2A, 0x97, 0x01, 0xED, 0x4B, 0x99, 0x01, 0x7D, 0xB4, 0xB1, 0xB0, 
+    0xC2, 0x10, 0x00, 0x13, 0x11, 0x00, 0x17, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 
+    0x12, 0xD9, 0x1A, 0x32, 0xA4, 0x09, 0x1C, 0x2A, 0x00, 0x16, 0xE9, 0xC3, 
+    0xF5, 0x11, 0x3E, 0x07, 0x3D, 0x20, 0xFD, 0x18, 0x00, 0x21, 0x11, 0x7F, 
+    0xC3, 0x21, 0x0A, 0x3E, 0x06, 0x3D, 0x20, 0xFD, 0xC3, 0xBF, 0x09, 0x21, 
+    0x11, 0x7F, 0xC3, 0x1E, 0x0A, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x00, 0x00, 
+    0x21, 0x11, 0x7F, 0xC3, 0x1B, 0x0A, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0xED, 
+    0x4F, 0xED, 0x4F, 0x00, 0x21, 0x11, 0x7F, 0xC3, 0x18, 0x0A, 0x3E, 0x03, 
+    0x3D, 0x20, 0xFD, 0x00, 0x21, 0x11, 0x7F, 0xC3, 0x15, 0x0A, 0xED, 0x4F, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x11, 0x7F, 0xC3, 0x12, 0x0A, 
+    0xED, 0x4F, 0xED, 0x4F, 0x21, 0x11, 0x7F, 0xC3, 0x0F, 0x0A, 0x21, 0x11, 
+    0x7F, 0xC3, 0x0C, 0x0A, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 
+    0x77, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 
+    0x77, 0x1A, 0x1C, 0x77, 0xC3, 0x97, 0x09, 0x0F, 0xE6, 0x03, 0x3C, 0x4F, 
+    0x26, 0x01, 0x1A, 0x07, 0x07, 0x07, 0xE6, 0x03, 0xC6, 0x5C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x47, 0x2F, 0xE6, 0x0F, 0x2E, 0xA7, 0xBE, 0x30, 0x02, 0x18, 
+    0x01, 0x7E, 0x80, 0x32, 0x11, 0x7F, 0x0D, 0xCA, 0x64, 0x0A, 0x3E, 0x00, 
+    0x3E, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3E, 0x03, 0x3D, 
+    0x20, 0xFD, 0xC3, 0x61, 0x0A, 0xC3, 0x2E, 0x0A, 0x00, 0xC3, 0x97, 0x09, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x00, 0x40, 0x01, 
+    0x01, 0x40, 0xC3, 0x68, 0x0C, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xC3, 
+    0x62, 0x0C, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x21, 
+    0x00, 0x40, 0x01, 0x01, 0x40, 0xC3, 0x5F, 0x0D, 0x21, 0x00, 0x40, 0x4D, 
+    0x44, 0x03, 0xC3, 0x3E, 0x0C, 0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 
+    0x3E, 0x00, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xD9, 0xC3, 0x3D, 0x0D, 
+    0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x00, 0x40, 
+    0x01, 0x01, 0x40, 0xC3, 0x2A, 0x0D, 0x21, 0x00, 0x40, 0x4D, 0x44, 0x03, 
+    0xC3, 0x47, 0x0C, 0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 
+    0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xD9, 0xC3, 0x08, 0x0D, 0x3E, 0x02, 
+    0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x00, 0x40, 0x01, 0x01, 
+    0x40, 0xC3, 0xF5, 0x0C, 0x21, 0x00, 0x40, 0x4D, 0x44, 0x03, 0xC3, 0x50, 
+    0x0C, 0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x00, 
+    0x40, 0x01, 0x01, 0x40, 0xD9, 0xC3, 0xD3, 0x0C, 0x3E, 0x02, 0x3D, 0x20, 
+    0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xC3, 
+    0xC0, 0x0C, 0x21, 0x00, 0x40, 0x4D, 0x44, 0x03, 0xC3, 0x59, 0x0C, 0x3E, 
+    0x08, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x40, 0x01, 
+    0x01, 0x40, 0xC3, 0x9D, 0x0C, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xC3, 0x87, 0x0C, 0x21, 0x00, 
+    0x40, 0x01, 0x01, 0x40, 0xC3, 0x81, 0x0C, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0xED, 0x4F, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0x68, 0x0C, 
+    0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0x62, 0x0C, 0x3E, 0x02, 0x3D, 
+    0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 
+    0xC3, 0x5F, 0x0D, 0x21, 0x02, 0x40, 0x4D, 0x44, 0x03, 0xC3, 0x3E, 0x0C, 
+    0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x02, 0x40, 
+    0x01, 0x03, 0x40, 0xD9, 0xC3, 0x3D, 0x0D, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 
+    0xED, 0x4F, 0xED, 0x4F, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0x2A, 
+    0x0D, 0x21, 0x02, 0x40, 0x4D, 0x44, 0x03, 0xC3, 0x47, 0x0C, 0x3E, 0x08, 
+    0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x02, 0x40, 0x01, 0x03, 
+    0x40, 0xD9, 0xC3, 0x08, 0x0D, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 
+    0xED, 0x4F, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0xF5, 0x0C, 0x21, 
+    0x02, 0x40, 0x4D, 0x44, 0x03, 0xC3, 0x50, 0x0C, 0x3E, 0x08, 0x3D, 0x20, 
+    0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xD9, 
+    0xC3, 0xD3, 0x0C, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xED, 0x4F, 
+    0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0xC0, 0x0C, 0x21, 0x02, 0x40, 
+    0x4D, 0x44, 0x03, 0xC3, 0x59, 0x0C, 0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x3E, 
+    0x00, 0x3E, 0x00, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 0x9D, 0x0C, 
+    0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x21, 0x02, 0x40, 0x01, 
+    0x03, 0x40, 0xC3, 0x87, 0x0C, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xC3, 
+    0x81, 0x0C, 0x1A, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xC3, 0x5F, 0x0D, 0x1A, 
+    0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xC3, 0x2A, 0x0D, 0x1A, 0x77, 0x1C, 0x1A, 
+    0x1C, 0x02, 0xC3, 0xF5, 0x0C, 0x1A, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xC3, 
+    0xC0, 0x0C, 0x1A, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 
+    0xC2, 0x6A, 0x0C, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xD9, 0xCB, 0x7E, 
+    0xC2, 0x76, 0x0C, 0x36, 0x2A, 0xD9, 0xC3, 0x97, 0x09, 0x1A, 0x77, 0x1C, 
+    0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0x89, 0x0C, 0xD9, 0x77, 
+    0x1C, 0x1A, 0x1C, 0x02, 0x18, 0x00, 0xD9, 0xCB, 0x7E, 0xC2, 0x97, 0x0C, 
+    0xD9, 0xD9, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 0xD9, 
+    0xCB, 0x7E, 0xC2, 0xA8, 0x0C, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0x1A, 
+    0xD9, 0xCB, 0x7E, 0xC2, 0xB5, 0x0C, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 
+    0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0xC2, 0x0C, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 
+    0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0xCE, 0x0C, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0xDD, 0x0C, 0xD9, 0x77, 
+    0x1C, 0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0xEA, 0x0C, 0xD9, 
+    0x77, 0x1C, 0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0xF7, 0x0C, 
+    0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0x03, 0x0D, 
+    0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 0xD9, 0xCB, 0x7E, 
+    0xC2, 0x12, 0x0D, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 
+    0x7E, 0xC2, 0x1F, 0x0D, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0x1A, 0xD9, 
+    0xCB, 0x7E, 0xC2, 0x2C, 0x0D, 0xD9, 0x77, 0x1C, 0x1A, 0x1C, 0x02, 0xD9, 
+    0xCB, 0x7E, 0xC2, 0x38, 0x0D, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 
+    0xD9, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0x47, 0x0D, 0xD9, 0x77, 0x1C, 0x1A, 
+    0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0x54, 0x0D, 0xD9, 0x77, 0x1C, 
+    0x1A, 0x1C, 0x02, 0x1A, 0xD9, 0xCB, 0x7E, 0xC2, 0x61, 0x0D, 0xD9, 0x77, 
+    0x1C, 0x1A, 0x1C, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0x6D, 0x0D, 0x36, 0x2A, 
+    0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x18, 0x00, 0x18, 0x00, 0xD9, 0xCB, 
+    0x7E, 0xC2, 0x7F, 0x0D, 0xD9, 0xC3, 0x62, 0x0C, 0x3E, 0x02, 0x3D, 0x20, 
+    0xFD, 0xC3, 0x90, 0x0D, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0x36, 0x28, 
+    0xC3, 0x06, 0x0E, 0x00, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0x36, 0x28, 
+    0xC3, 0xFE, 0x0D, 0x3E, 0x08, 0x3D, 0x20, 0xFD, 0x00, 0x21, 0x00, 0x40, 
+    0x01, 0x01, 0x40, 0x36, 0x28, 0xC3, 0x39, 0x0E, 0x3E, 0x03, 0x3D, 0x20, 
+    0xFD, 0x3E, 0x00, 0x3E, 0x00, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0x36, 
+    0x28, 0xC3, 0x2A, 0x0E, 0x18, 0x00, 0x18, 0x00, 0x21, 0x00, 0x40, 0x01, 
+    0x01, 0x40, 0x36, 0x28, 0xC3, 0x22, 0x0E, 0x3E, 0x09, 0x3D, 0x20, 0xFD, 
+    0x00, 0x00, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xD9, 0x36, 0x2A, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x18, 0x00, 0x00, 0xCB, 0x7E, 0xC2, 0xF4, 
+    0x0D, 0x36, 0x28, 0xC3, 0x1A, 0x0E, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 0x00, 
+    0x0E, 0x02, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 0x08, 0x0E, 0x02, 0x00, 0x00, 
+    0xCB, 0x7E, 0xC2, 0x10, 0x0E, 0x36, 0x2A, 0xC3, 0x97, 0x09, 0x1A, 0x1C, 
+    0xCB, 0x7E, 0xC2, 0x1C, 0x0E, 0x02, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 0x24, 
+    0x0E, 0x02, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 0x2C, 0x0E, 0x02, 0x00, 0x00, 
+    0xCB, 0x7E, 0xC2, 0x34, 0x0E, 0xD9, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 
+    0x12, 0xD9, 0x00, 0x00, 0xCB, 0x7E, 0xC2, 0x44, 0x0E, 0x36, 0x28, 0x1A, 
+    0x13, 0xCB, 0x7E, 0xC2, 0x4D, 0x0E, 0x02, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 
+    0x55, 0x0E, 0x02, 0x1A, 0x1C, 0xCB, 0x7E, 0xC2, 0x5D, 0x0E, 0x02, 0x3E, 
+    0x00, 0xCB, 0x7E, 0xC2, 0x65, 0x0E, 0x36, 0x2A, 0xC3, 0x97, 0x09, 0x0E, 
+    0x00, 0xC3, 0xBF, 0x0E, 0x0E, 0x01, 0xC3, 0xBF, 0x0E, 0x0E, 0x02, 0xC3, 
+    0xBF, 0x0E, 0x0E, 0x03, 0xC3, 0xBF, 0x0E, 0x0E, 0x00, 0xC3, 0xEE, 0x0E, 
+    0x0E, 0x01, 0xC3, 0xEE, 0x0E, 0x0E, 0x02, 0xC3, 0xEE, 0x0E, 0x0E, 0x03, 
+    0xC3, 0xEE, 0x0E, 0x0E, 0x00, 0xC3, 0x1D, 0x0F, 0x0E, 0x01, 0xC3, 0x1D, 
+    0x0F, 0x0E, 0x02, 0xC3, 0x1D, 0x0F, 0x0E, 0x03, 0xC3, 0x1D, 0x0F, 0x0E, 
+    0x00, 0xC3, 0x4C, 0x0F, 0x0E, 0x01, 0xC3, 0x4C, 0x0F, 0x0E, 0x02, 0xC3, 
+    0x4C, 0x0F, 0x0E, 0x03, 0xC3, 0x4C, 0x0F, 0x21, 0x14, 0x01, 0x79, 0xBE, 
+    0xD2, 0xD4, 0x0E, 0x1C, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 
+    0x00, 0xC3, 0xEA, 0x0E, 0x1A, 0x1C, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 
+    0x26, 0x1C, 0x87, 0x87, 0x6F, 0xF9, 0xE1, 0x22, 0x16, 0x01, 0xE1, 0x22, 
+    0x18, 0x01, 0x00, 0xC3, 0x97, 0x09, 0x21, 0x1C, 0x01, 0x79, 0xBE, 0xD2, 
+    0x03, 0x0F, 0x1C, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 
+    0xC3, 0x19, 0x0F, 0x1A, 0x1C, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 
+    0x1C, 0x87, 0x87, 0x6F, 0xF9, 0xE1, 0x22, 0x1E, 0x01, 0xE1, 0x22, 0x20, 
+    0x01, 0x00, 0xC3, 0x97, 0x09, 0x21, 0x24, 0x01, 0x79, 0xBE, 0xD2, 0x32, 
+    0x0F, 0x1C, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0xC3, 
+    0x48, 0x0F, 0x1A, 0x1C, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 0x1C, 
+    0x87, 0x87, 0x6F, 0xF9, 0xE1, 0x22, 0x26, 0x01, 0xE1, 0x22, 0x28, 0x01, 
+    0x00, 0xC3, 0x97, 0x09, 0x21, 0x2C, 0x01, 0x79, 0xBE, 0xD2, 0x61, 0x0F, 
+    0x1C, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0xC3, 0x77, 
+    0x0F, 0x1A, 0x1C, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 0x1C, 0x87, 
+    0x87, 0x6F, 0xF9, 0xE1, 0x22, 0x2E, 0x01, 0xE1, 0x22, 0x30, 0x01, 0x00, 
+    0xC3, 0x97, 0x09, 0x3E, 0x07, 0x3D, 0x20, 0xFD, 0x26, 0x01, 0xC3, 0xC8, 
+    0x10, 0x3E, 0x04, 0x3D, 0x20, 0xFD, 0x00, 0x00, 0x3E, 0x00, 0x26, 0x01, 
+    0xC3, 0xC2, 0x10, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x18, 
+    0x00, 0x26, 0x01, 0xC3, 0xBC, 0x10, 0x00, 0x00, 0x3E, 0x00, 0x26, 0x01, 
+    0xC3, 0xB6, 0x10, 0x3E, 0x0A, 0x3D, 0x20, 0xFD, 0x18, 0x00, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0x00, 0x26, 
+    0x01, 0xC3, 0xB0, 0x10, 0x3E, 0x09, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x00, 
+    0x26, 0x01, 0xC3, 0xA0, 0x10, 0x3E, 0x07, 0x3D, 0x20, 0xFD, 0xC3, 0xD9, 
+    0x0F, 0x26, 0x01, 0xC3, 0x9A, 0x10, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0xED, 
+    0x4F, 0x26, 0x01, 0xC3, 0x94, 0x10, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x00, 
+    0x00, 0x26, 0x01, 0xC3, 0x8E, 0x10, 0xED, 0x4F, 0xED, 0x4F, 0x3E, 0x00, 
+    0x26, 0x01, 0xC3, 0x88, 0x10, 0x3E, 0x0A, 0x3D, 0x20, 0xFD, 0x18, 0x00, 
+    0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0xED, 0x4F, 0x26, 0x01, 0xC3, 0x82, 0x10, 0x3E, 0x09, 0x3D, 0x20, 
+    0xFD, 0x3E, 0x00, 0x00, 0x26, 0x01, 0xC3, 0x70, 0x10, 0x3E, 0x07, 0x3D, 
+    0x20, 0xFD, 0xC3, 0x31, 0x10, 0x26, 0x01, 0xC3, 0x6A, 0x10, 0x3E, 0x05, 
+    0x3D, 0x20, 0xFD, 0xED, 0x4F, 0x26, 0x01, 0xC3, 0x64, 0x10, 0x3E, 0x03, 
+    0x3D, 0x20, 0xFD, 0x00, 0x00, 0x26, 0x01, 0xC3, 0x5E, 0x10, 0x18, 0x00, 
+    0xED, 0x4F, 0x3E, 0x00, 0x3E, 0x00, 0x26, 0x01, 0x1A, 0x1C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0x3E, 0x00, 0x00, 0xED, 0x4F, 0x1A, 0x1C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 
+    0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0xC3, 0xAA, 0x10, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 
+    0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 
+    0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 
+    0x1A, 0x1C, 0x6F, 0x1A, 0x1C, 0x77, 0xC3, 0x97, 0x09, 0x0F, 0xE6, 0x0F, 
+    0x3C, 0x4F, 0x26, 0x01, 0x3A, 0xA6, 0x01, 0x47, 0xDD, 0x21, 0xEA, 0x10, 
+    0x3E, 0x06, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xC3, 0xEE, 0x10, 0x0D, 0xCA, 
+    0x97, 0x09, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 0x1C, 0x6F, 
+    0x1A, 0x1C, 0x77, 0xB7, 0xFA, 0x31, 0x11, 0x80, 0xF2, 0x05, 0x11, 0x3E, 
+    0x7F, 0x08, 0x7D, 0xE6, 0x4F, 0xCB, 0x65, 0xD9, 0x20, 0x0C, 0xCB, 0x7E, 
+    0xC2, 0x0E, 0x11, 0x77, 0x08, 0x12, 0x18, 0x00, 0x18, 0x0D, 0xCB, 0x7E, 
+    0xC2, 0x1A, 0x11, 0x2C, 0x2C, 0x77, 0x2C, 0x08, 0x77, 0x2E, 0x00, 0xCB, 
+    0x7E, 0xC2, 0x27, 0x11, 0x36, 0x2A, 0xD9, 0xDD, 0xE9, 0xE6, 0x7F, 0xC3, 
+    0x05, 0x11, 0x23, 0x00, 0x0D, 0xCA, 0x97, 0x09, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0x7E, 0xB7, 0xF2, 0x53, 0x11, 0x3E, 0x09, 0x3D, 0x20, 
+    0xFD, 0x00, 0x00, 0x3E, 0x00, 0x18, 0xE3, 0x80, 0xFA, 0x5B, 0x11, 0xBE, 
+    0xC3, 0x05, 0x11, 0x3E, 0x7F, 0xC3, 0x05, 0x11, 0x3E, 0x09, 0x3D, 0x20, 
+    0xFD, 0xED, 0x4F, 0xED, 0x4F, 0xC3, 0x97, 0x09, 0x3E, 0x01, 0x32, 0x12, 
+    0x01, 0x3A, 0x13, 0x01, 0x3C, 0x32, 0x13, 0x01, 0xAF, 0x32, 0x12, 0x01, 
+    0x21, 0x94, 0x01, 0x7E, 0xD6, 0x01, 0x77, 0x2C, 0x7E, 0xDE, 0x00, 0x77, 
+    0x2C, 0x7E, 0xDE, 0x00, 0x77, 0x18, 0x00, 0x00, 0xC3, 0x97, 0x09, 0x3A, 
+    0x3C, 0x01, 0x3D, 0x32, 0x3C, 0x01, 0xC2, 0xB4, 0x11, 0x21, 0x00, 0x01, 
+    0xCB, 0xE6, 0x21, 0x02, 0x01, 0xCB, 0xB6, 0x1C, 0x1C, 0x1C, 0x3E, 0x03, 
+    0x3D, 0x20, 0xFD, 0x18, 0x00, 0xC3, 0x97, 0x09, 0x1A, 0x6F, 0x1C, 0x1A, 
+    0x67, 0x1C, 0xED, 0x4B, 0x04, 0x01, 0x09, 0x22, 0x34, 0x01, 0x1A, 0x21, 
+    0x06, 0x01, 0x8E, 0x1C, 0x32, 0x36, 0x01, 0xAF, 0x12, 0xC3, 0x97, 0x09, 
+    0x21, 0x00, 0x01, 0xCB, 0xE6, 0x21, 0x02, 0x01, 0xCB, 0xB6, 0x3E, 0x07, 
+    0x3D, 0x20, 0xFD, 0xC3, 0x97, 0x09, 0x2D, 0x36, 0x00, 0x3E, 0x05, 0x3D, 
+    0x20, 0xFD, 0xED, 0x4F, 0x00, 0xC3, 0x00, 0x02, 0x36, 0x00, 0xC3, 0x02, 
+    0x12, 0x21, 0x12, 0x01, 0x36, 0x01, 0x2C, 0x35, 0xFA, 0xF0, 0x11, 0xC2, 
+    0xE2, 0x11, 0x2D, 0x36, 0x00, 0x31, 0x00, 0x16, 0x21, 0x00, 0x01, 0xCB, 
+    0x76, 0xCA, 0x38, 0x12, 0xCB, 0xB6, 0x2C, 0x2C, 0xCB, 0xF6, 0x2A, 0x04, 
+    0x01, 0x22, 0x34, 0x01, 0x3A, 0x06, 0x01, 0x32, 0x36, 0x01, 0x3A, 0x10, 
+    0x01, 0x32, 0x3C, 0x01, 0x21, 0x00, 0x00, 0x22, 0x94, 0x01, 0xAF, 0x32, 
+    0x96, 0x01, 0x21, 0x00, 0x01, 0xC3, 0xE4, 0x12, 0xCB, 0x6E, 0xCA, 0x5B, 
+    0x12, 0xCB, 0xAE, 0x2C, 0x2C, 0xCB, 0xF6, 0x11, 0x44, 0x01, 0x31, 0x00, 
+    0x16, 0xCD, 0xB5, 0x14, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 0x18, 0x00, 0xED, 
+    0x4F, 0x21, 0x00, 0x01, 0xC3, 0xE4, 0x12, 0xCB, 0x66, 0xCA, 0xDD, 0x12, 
+    0xCB, 0xA6, 0x2C, 0x2C, 0xCB, 0xB6, 0x11, 0x64, 0x01, 0x31, 0x00, 0x16, 
+    0xCD, 0xB5, 0x14, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0xED, 0x4F, 
+    0xED, 0x4F, 0x00, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0x36, 0x28, 0xCB, 
+    0x7E, 0xC2, 0x8F, 0x12, 0xAF, 0x02, 0x3C, 0xCB, 0x7E, 0xC2, 0x97, 0x12, 
+    0x02, 0xCB, 0x7E, 0xC2, 0x9D, 0x12, 0xD9, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0xCB, 0x7E, 0xC2, 0xAB, 0x12, 0x36, 0x28, 0x3E, 0x02, 
+    0xCB, 0x7E, 0xC2, 0xB4, 0x12, 0x02, 0xC6, 0x02, 0xCB, 0x7E, 0xC2, 0xBC, 
+    0x12, 0x02, 0x3C, 0xCB, 0x7E, 0xC2, 0xC3, 0x12, 0x02, 0x3C, 0xCB, 0x7E, 
+    0xC2, 0xCA, 0x12, 0x02, 0xCB, 0x7E, 0xC2, 0xD0, 0x12, 0x36, 0x2A, 0x21, 
+    0x00, 0x01, 0xC3, 0xE4, 0x12, 0x21, 0x00, 0x01, 0x18, 0x00, 0x3E, 0x00, 
+    0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0xCB, 0x46, 0xCA, 0x32, 0x13, 
+    0xCB, 0x86, 0xED, 0x4B, 0x08, 0x01, 0x21, 0x14, 0x01, 0x79, 0xBE, 0xD2, 
+    0x0A, 0x13, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0xC3, 
+    0x1F, 0x13, 0x78, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 0x07, 0x6F, 
+    0x29, 0x29, 0xF9, 0xE1, 0x22, 0x16, 0x01, 0xE1, 0x22, 0x18, 0x01, 0x21, 
+    0x00, 0x01, 0x3E, 0x00, 0x3E, 0x00, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 
+    0xD9, 0xED, 0x4F, 0xED, 0x4F, 0x00, 0xCB, 0x4E, 0xCA, 0x78, 0x13, 0xCB, 
+    0x8E, 0xED, 0x4B, 0x0A, 0x01, 0x21, 0x1C, 0x01, 0x79, 0xBE, 0xD2, 0x51, 
+    0x13, 0x3E, 0x05, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0xC3, 0x66, 
+    0x13, 0x78, 0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 0x07, 0x6F, 0x29, 
+    0x29, 0xF9, 0xE1, 0x22, 0x1E, 0x01, 0xE1, 0x22, 0x20, 0x01, 0xD9, 0x0A, 
+    0x03, 0xCB, 0x90, 0x12, 0xD9, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 
+    0x4F, 0x21, 0x00, 0x01, 0xCB, 0x56, 0xCA, 0xBE, 0x13, 0xCB, 0x96, 0xED, 
+    0x4B, 0x0C, 0x01, 0x21, 0x24, 0x01, 0x79, 0xBE, 0xD2, 0x97, 0x13, 0x3E, 
+    0x05, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0xC3, 0xAC, 0x13, 0x78, 
+    0xB7, 0x20, 0x02, 0x0E, 0x00, 0x71, 0x26, 0x07, 0x6F, 0x29, 0x29, 0xF9, 
+    0xE1, 0x22, 0x26, 0x01, 0xE1, 0x22, 0x28, 0x01, 0xD9, 0x0A, 0x03, 0xCB, 
+    0x90, 0x12, 0xD9, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0xED, 0x4F, 0x21, 
+    0x00, 0x01, 0xCB, 0x5E, 0xCA, 0x00, 0x14, 0xCB, 0x9E, 0xED, 0x4B, 0x0E, 
+    0x01, 0x21, 0x2C, 0x01, 0x79, 0xBE, 0xD2, 0xDD, 0x13, 0x3E, 0x05, 0x3D, 
+    0x20, 0xFD, 0x3E, 0x00, 0x3E, 0x00, 0xC3, 0xF2, 0x13, 0x78, 0xB7, 0x20, 
+    0x02, 0x0E, 0x00, 0x71, 0x26, 0x07, 0x6F, 0x29, 0x29, 0xF9, 0xE1, 0x22, 
+    0x2E, 0x01, 0xE1, 0x22, 0x30, 0x01, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 
+    0xD9, 0x3E, 0x02, 0x3D, 0x20, 0xFD, 0x18, 0x00, 0x01, 0x02, 0x01, 0x0A, 
+    0xE6, 0xF0, 0x2A, 0x00, 0x1C, 0xED, 0x5B, 0x16, 0x01, 0xED, 0x52, 0x28, 
+    0x02, 0xF6, 0x01, 0x08, 0xAF, 0x32, 0xA0, 0x01, 0xED, 0x4F, 0xED, 0x4F, 
+    0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x08, 0x2A, 0x00, 0x1C, 0xED, 
+    0x5B, 0x1E, 0x01, 0xED, 0x52, 0x28, 0x02, 0xF6, 0x02, 0x2A, 0x00, 0x1C, 
+    0xED, 0x5B, 0x26, 0x01, 0xED, 0x52, 0x28, 0x02, 0xF6, 0x04, 0x2A, 0x00, 
+    0x1C, 0xED, 0x5B, 0x2E, 0x01, 0xED, 0x52, 0x28, 0x02, 0xF6, 0x08, 0x02, 
+    0x3A, 0x11, 0x01, 0xB7, 0xCA, 0x00, 0x02, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 
+    0x12, 0xD9, 0x3E, 0x06, 0x3D, 0x20, 0xFD, 0x3E, 0x00, 0x3A, 0x11, 0x01, 
+    0xB7, 0xCA, 0x79, 0x14, 0x2A, 0x80, 0x01, 0x23, 0x22, 0x80, 0x01, 0x2A, 
+    0x82, 0x01, 0x23, 0x22, 0x82, 0x01, 0xC3, 0x53, 0x14, 0x3E, 0x04, 0x3D, 
+    0x20, 0xFD, 0xC3, 0x81, 0x14, 0xC3, 0x00, 0x02, 0x11, 0x80, 0x2B, 0xCD, 
+    0x91, 0x14, 0x11, 0x80, 0x2A, 0xCD, 0x91, 0x14, 0xC9, 0x21, 0x00, 0x40, 
+    0xCB, 0x7E, 0x20, 0xFC, 0x72, 0xCB, 0x7E, 0x20, 0xFC, 0x2C, 0x73, 0xC9, 
+    0x21, 0x00, 0x40, 0xCB, 0x7E, 0x20, 0xFC, 0x2C, 0x2C, 0x72, 0x2D, 0x2D, 
+    0xCB, 0x7E, 0x20, 0xFC, 0x2C, 0x2C, 0x2C, 0x73, 0xC9, 0xD9, 0x0A, 0x03, 
+    0xCB, 0x90, 0x12, 0xD9, 0x21, 0x00, 0x40, 0x01, 0x01, 0x40, 0xCD, 0x36, 
+    0x15, 0x21, 0x02, 0x40, 0x01, 0x03, 0x40, 0xD9, 0x36, 0x2A, 0x0A, 0x03, 
+    0xCB, 0x90, 0x12, 0xD9, 0xCD, 0x36, 0x15, 0xC3, 0xDA, 0x14, 0xD9, 0x36, 
+    0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x3E, 0x03, 0x3D, 0x20, 0xFD, 
+    0x18, 0x00, 0xED, 0x4F, 0x21, 0xA7, 0x01, 0x3A, 0xA3, 0x01, 0x4F, 0x18, 
+    0x00, 0x18, 0x00, 0x1A, 0x47, 0x2F, 0xE6, 0x0F, 0x2E, 0xA7, 0xBE, 0x30, 
+    0x02, 0x18, 0x01, 0x7E, 0x80, 0x1C, 0xCB, 0x09, 0x30, 0x03, 0x23, 0x18, 
+    0x03, 0x32, 0x11, 0x7F, 0xD9, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xD9, 0x1A, 
+    0x47, 0x2F, 0xE6, 0x0F, 0x2E, 0xA7, 0xBE, 0x30, 0x02, 0x18, 0x01, 0x7E, 
+    0x80, 0x1C, 0xCB, 0x09, 0x30, 0x03, 0x23, 0x18, 0x03, 0x32, 0x11, 0x7F, 
+    0xCB, 0x4B, 0x23, 0x20, 0xC2, 0xC9, 0xD9, 0xCB, 0x7E, 0xC2, 0x37, 0x15, 
+    0xD9, 0x36, 0x80, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0x44, 
+    0x15, 0xD9, 0x36, 0x81, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 
+    0x51, 0x15, 0xD9, 0x36, 0x82, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 
+    0xC2, 0x5E, 0x15, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xCB, 0x7E, 
+    0xC2, 0x6A, 0x15, 0xD9, 0x36, 0x84, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 
+    0x7E, 0xC2, 0x77, 0x15, 0xD9, 0x36, 0x85, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 
+    0xCB, 0x7E, 0xC2, 0x84, 0x15, 0xD9, 0x36, 0x86, 0x1A, 0x1C, 0x00, 0x02, 
+    0xD9, 0xCB, 0x7E, 0xC2, 0x91, 0x15, 0x36, 0x2A, 0x0A, 0x03, 0xCB, 0x90, 
+    0x12, 0xCB, 0x7E, 0xC2, 0x9D, 0x15, 0xD9, 0x00, 0x00, 0x36, 0x88, 0x1A, 
+    0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0xAC, 0x15, 0xD9, 0x36, 0x89, 
+    0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0xB9, 0x15, 0xD9, 0x36, 
+    0x8A, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 0xC6, 0x15, 0x36, 
+    0x2A, 0x0A, 0x03, 0xCB, 0x90, 0x12, 0xCB, 0x7E, 0xC2, 0xD2, 0x15, 0xD9, 
+    0x00, 0x00, 0x36, 0x8C, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 0xC2, 
+    0xE1, 0x15, 0xD9, 0x36, 0x8D, 0x1A, 0x1C, 0x00, 0x02, 0xD9, 0xCB, 0x7E, 
+    0xC2, 0xEE, 0x15, 0xD9, 0x36, 0x8E, 0x1A, 0x1C, 0x00, 0x02, 0xC9, 0x00, 
+    0x00, 0x00, 0x00, 0x00, 0xA7, 0x09, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 
+    0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 
+    0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 
+    0xAA, 0x09, 0xB7, 0x09, 0xC5, 0x09, 0xD2, 0x09, 0xE2, 0x09, 0xEE, 0x09, 
+    0xFC, 0x09, 0x06, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 0x27, 0x0A, 
+    0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x68, 0x0A, 0x79, 0x0A, 
+    0x82, 0x0A, 0x94, 0x0A, 0x9D, 0x0A, 0xB0, 0x0A, 0xC2, 0x0A, 0xCB, 0x0A, 
+    0xDE, 0x0A, 0xF0, 0x0A, 0xF9, 0x0A, 0x0C, 0x0B, 0x1E, 0x0B, 0x27, 0x0B, 
+    0x39, 0x0B, 0x4A, 0x0B, 0x53, 0x0B, 0x64, 0x0B, 0x6D, 0x0B, 0x7F, 0x0B, 
+    0x88, 0x0B, 0x9B, 0x0B, 0xAD, 0x0B, 0xB6, 0x0B, 0xC9, 0x0B, 0xDB, 0x0B, 
+    0xE4, 0x0B, 0xF7, 0x0B, 0x09, 0x0C, 0x12, 0x0C, 0x24, 0x0C, 0x35, 0x0C, 
+    0x88, 0x0D, 0x9B, 0x0D, 0xA7, 0x0D, 0xB8, 0x0D, 0xCC, 0x0D, 0xDB, 0x0D, 
+    0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 
+    0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x60, 0x11, 0x6F, 0x0E, 0x83, 0x0E, 
+    0x97, 0x0E, 0xAB, 0x0E, 0x74, 0x0E, 0x88, 0x0E, 0x9C, 0x0E, 0xB0, 0x0E, 
+    0x79, 0x0E, 0x8D, 0x0E, 0xA1, 0x0E, 0xB5, 0x0E, 0x7E, 0x0E, 0x92, 0x0E, 
+    0xA6, 0x0E, 0xBA, 0x0E, 0x7B, 0x0F, 0x85, 0x0F, 0x93, 0x0F, 0xA2, 0x0F, 
+    0xAB, 0x0F, 0xC4, 0x0F, 0xD1, 0x0F, 0xDE, 0x0F, 0xEA, 0x0F, 0xF6, 0x0F, 
+    0x01, 0x10, 0x1C, 0x10, 0x29, 0x10, 0x36, 0x10, 0x42, 0x10, 0x4E, 0x10, 
+    0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 
+    0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 0xD1, 0x10, 
+    0x60, 0x11, 0x6C, 0x11, 0x93, 0x11, 0xD0, 0x11, 0x21, 0x04, 0x01, 0x3E, 
+    0x00, 0x06, 0x40, 0x77, 0x23, 0x10, 0xFC, 0x21, 0x64, 0x01, 0x3E, 0xFF, 
+    0x06, 0x18, 0x77, 0x23, 0x10, 0xFC, 0x21, 0x7C, 0x01, 0x36, 0x9F, 0x23, 
+    0x36, 0xBF, 0x23, 0x36, 0xDF, 0x23, 0x36, 0xFF, 0x21, 0x64, 0x01, 0x11, 
+    0x44, 0x01, 0x01, 0x1C, 0x00, 0xED, 0xB0, 0x21, 0x00, 0x18, 0x3E, 0x80, 
+    0x06, 0x00, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x77, 0x23, 0x10, 0xF6, 
+    0x3E, 0x00, 0x21, 0x60, 0x01, 0x77, 0x21, 0x61, 0x01, 0x77, 0x21, 0x12, 
+    0x01, 0x77, 0x21, 0x13, 0x01, 0x77, 0xCD, 0x84, 0x14, 0x21, 0x00, 0x18, 
+    0x22, 0x38, 0x01, 0x21, 0x00, 0x19, 0x22, 0x3A, 0x01, 0x4D, 0x44, 0x21, 
+    0x00, 0x40, 0x11, 0x01, 0x40, 0xD9, 0x2A, 0x00, 0x1C, 0x22, 0x16, 0x01, 
+    0x21, 0x01, 0x00, 0x22, 0x18, 0x01, 0xAF, 0x32, 0x14, 0x01, 0x2A, 0x00, 
+    0x1C, 0x22, 0x1E, 0x01, 0x21, 0x01, 0x00, 0x22, 0x20, 0x01, 0xAF, 0x32, 
+    0x1C, 0x01, 0x2A, 0x00, 0x1C, 0x22, 0x26, 0x01, 0x21, 0x01, 0x00, 0x22, 
+    0x28, 0x01, 0xAF, 0x32, 0x24, 0x01, 0x2A, 0x00, 0x1C, 0x22, 0x2E, 0x01, 
+    0x21, 0x01, 0x00, 0x22, 0x30, 0x01, 0xAF, 0x32, 0x2C, 0x01, 0x21, 0x97, 
+    0x01, 0xAF, 0x06, 0x29, 0x77, 0x23, 0x10, 0xFC, 0x3D, 0x06, 0x20, 0x77, 
+    0x23, 0x10, 0xFC, 0x3E, 0xC0, 0x32, 0xA8, 0x01, 0x3E, 0x80, 0x32, 0x02, 
+    0x01, 0xC3, 0x00, 0x02
+};
+
@@ -0,0 +1,14 @@
+/* Generated with bintoc v0.02                           */
+/* A binary to C language resource converter             */
+/* Github: https://github.com/tapule/mddev               */
+
+#ifndef Z80_XGM_H
+#define Z80_XGM_H
+
+#include <stdint.h>
+
+#define Z80_XGM_SIZE    6088
+
+extern const uint8_t z80_xgm[Z80_XGM_SIZE];
+
+#endif /* Z80_XGM_H */
@@ -4,7 +4,7 @@
  * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021 
  * Github: https://github.com/tapule/mddev
  *
- * bintoc v0.01
+ * bintoc v0.02
  *
  * A binary to C language resource converter
  *
@@ -58,6 +58,11 @@
  *
  * You can extract binary data from a unique file too:
  *  bintoc -s pngs/path/file.bin -d dest/path
+ *
+ * With the -c option, data is compressed using the MDDev streaming LZ format
+ * (see src/stream.h). Compressed data can only be exported as uint8_t and its
+ * size define is the compressed size. The decompressed size is stored in the
+ * first two bytes (big endian) and it is always padded to an even size.
  */
 #include <stdio.h>
 #include <stdlib.h>
@@ -78,8 +83,14 @@
 #define PARAMS_STOP             1   /* Procesado de parámetros ok, finalizar */
 #define PARAMS_CONTINUE         2   /* Procesado de parámetros ok, procesar */
 
+/* Streaming LZ format limits */
+#define LZ_LITERALS_MAX         128     /* Literals per token */
+#define LZ_MATCH_MIN            3       /* Shortest match */
+#define LZ_MATCH_MAX            18      /* Longest match */
+#define LZ_OFFSET_MAX           2048    /* Farthest match, the window size */
+
 const char version_text [] =
-    "bintoc v0.01\n"
+    "bintoc v0.02\n"
     "A binary to C language resource converter\n"
     "Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021\n"
     "Github: https://github.com/tapule/mddev\n";
@@ -102,7 +113,8 @@ const char help_text [] =
     "  -t <u8|u16|u32>     Set the data type to use in the conversion\n"
     "     <s8|s16|s32>     uint8_t will be used as default data type\n"
     "  -ma <integer>       Set a memory alignment to use in the conversion\n"
-    "  -sa <integer>       Set a data size alignment for the converted data\n";
+    "  -sa <integer>       Set a data size alignment for the converted data\n"
+    "  -c                  Compress the data with the streaming LZ format\n";
 
 /* Stores the input parameters */
 typedef struct params_t
@@ -114,6 +126,7 @@ typedef struct params_t
     uint8_t type_size;      /* Destination type size in bytes, default 1 */
     int32_t memory_align;   /* Memory alignment size in bytes, default none */
     int32_t size_align;     /* Size alignment in bytes, default none */
+    bool compress;          /* Compress the data, default false */
 } params_t;
 
 /* Stores files's data */
@@ -306,6 +319,11 @@ uint8_t parse_params(uint32_t argc, char** argv, params_t *params)
                 return PARAMS_ERROR;
             }
         } 
+        /* Data compression */
+        else if (strcmp(argv[i], "-c") == 0)
+        {
+            params->compress = true;
+        }
         else 
         {
             fprintf(stderr, "%s: unknown option: '%s'\n", argv[0], argv[i]);
@@ -316,6 +334,106 @@ uint8_t parse_params(uint32_t argc, char** argv, params_t *params)
     return PARAMS_CONTINUE;
 }
 
+/**
+ * @brief Compresses data using the streaming LZ format
+ * 
+ * Greedy LZ77 compression searching the longest match in the previous
+ * LZ_OFFSET_MAX bytes.
+ * 
+ * @param src Data to compress
+ * @param size Data size in bytes, it must be even and less than 64KB
+ * @param dest_size Where to store the compressed size in bytes
+ * @return uint8_t* Compressed data or NULL on error
+ */
+uint8_t *lz_compress(const uint8_t *src, const uint32_t size,
+                     uint32_t *dest_size)
+{
+    uint8_t *dest;
+    uint32_t dest_pos;
+    uint32_t pos;
+    uint32_t literals;      /* Pending literals to write */
+    uint32_t best_length;
+    uint32_t best_offset;
+    uint32_t length;
+    uint32_t offset;
+
+    /* Worst case, all literals plus a token each 128 bytes and the header */
+    dest = malloc(size + (size / LZ_LITERALS_MAX) + 3);
+    if (!dest)
+    {
+        return NULL;
+    }
+
+    /* Decompressed size header */
+    dest[0] = (size >> 8) & 0xFF;
+    dest[1] = size & 0xFF;
+    dest_pos = 2;
+
+    pos = 0;
+    literals = 0;
+    while (pos < size)
+    {
+        /* Search the longest match in the window */
+        best_length = 0;
+        best_offset = 0;
+        for (offset = 1; offset <= LZ_OFFSET_MAX && offset <= pos; ++offset)
+        {
+            length = 0;
+            while (length < LZ_MATCH_MAX && pos + length < size &&
+                   src[pos + length] == src[pos + length - offset])
+            {
+                ++length;
+            }
+            if (length > best_length)
+            {
+                best_length = length;
+                best_offset = offset;
+                if (length == LZ_MATCH_MAX)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (best_length >= LZ_MATCH_MIN)
+        {
+            /* Flush pending literals before the match */
+            if (literals)
+            {
+                dest[dest_pos++] = literals - 1;
+                memcpy(&dest[dest_pos], &src[pos - literals], literals);
+                dest_pos += literals;
+                literals = 0;
+            }
+            dest[dest_pos++] = 0x80 | ((best_length - LZ_MATCH_MIN) << 3) |
+                               ((best_offset - 1) >> 8);
+            dest[dest_pos++] = (best_offset - 1) & 0xFF;
+            pos += best_length;
+        }
+        else
+        {
+            ++literals;
+            ++pos;
+            if (literals == LZ_LITERALS_MAX)
+            {
+                dest[dest_pos++] = literals - 1;
+                memcpy(&dest[dest_pos], &src[pos - literals], literals);
+                dest_pos += literals;
+                literals = 0;
+            }
+        }
+    }
+    if (literals)
+    {
+        dest[dest_pos++] = literals - 1;
+        memcpy(&dest[dest_pos], &src[pos - literals], literals);
+        dest_pos += literals;
+    }
+
+    *dest_size = dest_pos;
+    return dest;
+}
+
 /**
  * @brief Processes a file and converts it to binary aligned data
  * 
@@ -323,16 +441,20 @@ uint8_t parse_params(uint32_t argc, char** argv, params_t *params)
  * @param file File to process
  * @param type_size The size in bytes of our data type
  * @param size_align The file size alignment needed in the binary data
+ * @param compress Compress the data with the streaming LZ format
  * @param file_index Index in the files array to store the data
  * @return true if everythig was correct, false otherwise
  */
 bool file_process(const char* path, const char *file, const uint8_t type_size,
-                  const uint32_t size_align, const uint32_t file_index)
+                  const uint32_t size_align, const bool compress,
+                  const uint32_t file_index)
 {
     char file_path[MAX_PATH_LENGTH];
     FILE *p_file;
     uint32_t file_size;
     uint32_t data_size;
+    uint32_t compressed_size;
+    uint8_t *compressed;
     char *file_ext;
 
     /* Builds the complete file path */
@@ -369,10 +491,45 @@ bool file_process(const char* path, const char *file, const uint8_t type_size,
         data_size = data_size * size_align;
     }
 
+    /* Compressed data is decompressed to VRam, it must have an even size */
+    if (compress)
+    {
+        data_size = (data_size + 1) & ~1;
+        if (data_size > 0xFFFF)
+        {
+            printf("\tError: Files to compress must be less than 64KB\n");
+            fclose(p_file);
+            return false;
+        }
+    }
+
     files[file_index].size = data_size / type_size;
     files[file_index].data = malloc(data_size);
     memset(files[file_index].data, 0, data_size);
     fread(files[file_index].data, 1, data_size, p_file);
+    fclose(p_file);
+
+    if (compress)
+    {
+        compressed = lz_compress(files[file_index].data, data_size,
+                                 &compressed_size);
+        if (!compressed)
+        {
+            printf("\tError: Can't compress file: %s\n", file_path);
+            return false;
+        }
+        if (compressed_size > 0xFFFF)
+        {
+            printf("\tError: Compressed data is bigger than 64KB\n");
+            free(compressed);
+            return false;
+        }
+        printf("\tCompressed %d bytes to %d bytes\n", data_size,
+               compressed_size);
+        free(files[file_index].data);
+        files[file_index].data = compressed;
+        files[file_index].size = compressed_size;
+    }
 
     /* Save the file original name */
     strcpy(files[file_index].file, file);
@@ -419,7 +576,7 @@ bool build_header_file(const char *path, const char *name, const char *data_type
     }
 
     /* An information message */
-    fprintf(h_file, "/* Generated with bintoc v0.01                           */\n");
+    fprintf(h_file, "/* Generated with bintoc v0.02                           */\n");
     fprintf(h_file, "/* A binary to C language resource converter             */\n");
     fprintf(h_file, "/* Github: https://github.com/tapule/mddev               */\n\n");
 
@@ -600,6 +757,13 @@ int main(int argc, char **argv)
         }
     }
 
+    /* Compressed data is a bytes stream */
+    if (params.compress && params.type_size > 1)
+    {
+        fprintf(stderr, "Error: Compressed data can only use u8 data type\n");
+        return EXIT_FAILURE;
+    }
+
     /* First try to open source path as a directory */
     dir = opendir(params.src_path);
     if (dir != NULL)
@@ -619,7 +783,8 @@ int main(int argc, char **argv)
             if (dir_entry->d_type == DT_REG)
             {
                 if (file_process(params.src_path, dir_entry->d_name, 
-                                 params.type_size, params.size_align, file_index))
+                                 params.type_size, params.size_align,
+                                 params.compress, file_index))
                 {
                     printf("\tFile to binary: %s -> %s\n", dir_entry->d_name, 
                         files[file_index].name);
@@ -647,7 +812,7 @@ int main(int argc, char **argv)
         printf(version_text);
         printf("\nReading file...\n");
         if (file_process(params.src_path, file_name, params.type_size,
-                         params.size_align, file_index))
+                         params.size_align, params.compress, file_index))
         {
             printf("\tFile to binary: %s -> %s\n", file_name, 
                 files[file_index].name);
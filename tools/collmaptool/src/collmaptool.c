@@ -0,0 +1,687 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * collmaptool v0.01
+ *
+ * A Sega Megadrive/Genesis collision map builder
+ *
+ * Builds packed collision maps from indexed png files. Each pixel in the png
+ * image is a tile in the level and its color index is the tile collision value
+ * (0 empty, 1 solid, 2 platform, 3 hazard, 4..15 slopes). Values are packed
+ * using 2 or 4 bits per tile, the first tile in the high bits of each byte.
+ * Each map row is padded to a whole number of bytes.
+ *
+ * Usage example: collmaptool -s pngs/path -d dest/path -n res_coll -b 2
+ *
+ * It processes images in "pngs/path/*.png" to build the collision maps. It
+ * generates the C source files "res_coll.h" and "res_coll.c" in "dest/path"
+ * directory.
+ * For each png file, collmaptool adds a define with its dimensions in tiles, a
+ * define with the bits per tile, a define with its size in bytes and a const
+ * uint8_t array containing the packed collision data.
+ *
+ * If -s parameter is not specified, the current directory will be used as
+ * source folder.
+ * If -d parameter is not specified, the current directory will be used as
+ * destination folder.
+ * If -b parameter is not specified, 2 bits per tile will be used.
+ *
+ * If "level1.png" is in "pngs/path" the previos example usage generates:
+ *
+ * dest/path/res_coll.h
+ * #ifndef RES_COLL_H
+ * #define RES_COLL_H
+ *
+ * #include <stdint.h>
+ *
+ * #define RES_COLL_LEVEL1_WIDTH    8
+ * #define RES_COLL_LEVEL1_HEIGHT    2
+ * #define RES_COLL_LEVEL1_BITS    2
+ * #define RES_COLL_LEVEL1_SIZE    4
+ *
+ * extern const uint8_t res_coll_level1[RES_COLL_LEVEL1_SIZE];
+ *
+ * #endif // RES_COLL_H
+ *
+ * dest/path/res_coll.c
+ * #include "res_coll.h"
+ *
+ * const uint8_t res_coll_level1[RES_COLL_LEVEL1_SIZE] = {
+ *     0x00, 0x00,
+ *     0x55, 0x55
+ * };
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <ctype.h>
+#include "lodepng.h"
+
+#define MAX_MAPS                512     /* Enough?? */
+#define MAX_FILE_NAME_LENGTH    128     /* Max length for file names */
+#define MAX_PATH_LENGTH         1024    /* Max length for paths */
+
+#define PARAMS_ERROR            0   /* Error en procesado de parámetros */
+#define PARAMS_STOP             1   /* Procesado de parámetros ok, finalizar */
+#define PARAMS_CONTINUE         2   /* Procesado de parámetros ok, procesar */
+
+const char version_text [] =
+    "collmaptool v0.01\n"
+    "A Sega Megadrive/Genesis collision map builder\n"
+    "Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021\n"
+    "Github: https://github.com/tapule/mddev\n";
+
+const char help_text [] =
+    "usage: collmaptool [options]\n"
+    "\n"
+    "Options:\n"
+    "  -v, --version       Show version information and exit\n"
+    "  -h, --help          Show this help message and exit\n"
+    "  -s <path>|<file>    Use a directory path to look for png files\n"
+    "                      or a unique png file to build a map from\n"
+    "                      Current directory will be used as default\n"
+    "  -d <path>           Use a path to save generated C source files\n"
+    "                      The current directory will be used as default\n"
+    "  -n <name>           Use name as prefix for files, defines, vars, etc\n"
+    "                      If it is not specified, \"coll\" will be used as\n"
+    "                      default for multiple files. Source file name itself\n"
+    "                      will be used if there is only one source file\n"
+    "  -b <bits>           Bits per tile in the packed map, 2 or 4\n"
+    "                      2 bits per tile will be used as default\n";
+
+/* Stores the input parameters */
+typedef struct params_t
+{
+    char *src_path;   /* Folder with the source images in png files */
+    char *dest_path;  /* Destination folder for the generated .h and .c */
+    char *dest_name;  /* Base name for the generated .h and .c files */
+    uint8_t bits;     /* Bits per tile */
+} params_t;
+
+/* Stores collision map's data */
+typedef struct collmap_t
+{
+    char file[MAX_FILE_NAME_LENGTH];           /* Original png file */
+    char name[MAX_FILE_NAME_LENGTH];           /* Name without the extension */
+    char define[MAX_FILE_NAME_LENGTH];         /* Base name for the defines */
+    uint8_t *data;                             /* Packed map data */
+    uint16_t width;                            /* Map width in tiles */
+    uint16_t height;                           /* Map height in tiles */
+    uint16_t pitch;                            /* Bytes per map row */
+} collmap_t;
+
+/* Global storage for the parsed maps */
+collmap_t maps[MAX_MAPS];
+
+/**
+ * @brief Convert a string to upper case
+ *
+ * @param str string to convert
+ */
+void strtoupper(char *str)
+{
+    char *c;
+    c = str;
+
+    while (*c)
+    {
+        *c = toupper(*c);
+        ++c;
+    }
+}
+
+/**
+ * @brief Gets a pixel color index from a lodepng raw image
+ *
+ * @param image Raw image data, scanlines without padding bits
+ * @param width Image width in pixels
+ * @param bitdepth Bits per pixel
+ * @param x Pixel horizontal position
+ * @param y Pixel vertical position
+ * @return uint8_t Pixel color index
+ */
+uint8_t pixel_get(const uint8_t *image, const uint32_t width,
+                  const uint32_t bitdepth, const uint32_t x, const uint32_t y)
+{
+    uint32_t bit;
+
+    if (bitdepth == 8)
+    {
+        return image[(y * width) + x];
+    }
+    /* Pixels are packed from the high bits */
+    bit = ((y * width) + x) * bitdepth;
+    return (image[bit / 8] >> (8 - bitdepth - (bit % 8))) & ((1 << bitdepth) - 1);
+}
+
+/**
+ * @brief Packs an indexed image into a collision map
+ *
+ * @param image Raw image data
+ * @param width Image width in pixels (map tiles)
+ * @param height Image height in pixels (map tiles)
+ * @param bitdepth Image bits per pixel
+ * @param bits Bits per tile in the collision map
+ * @param map Where to store the packed map
+ * @return true on success, false otherwise
+ */
+bool collmap_pack(const uint8_t *image, const uint32_t width,
+                  const uint32_t height, const uint32_t bitdepth,
+                  const uint8_t bits, collmap_t *map)
+{
+    uint32_t x;
+    uint32_t y;
+    uint32_t bit;
+    uint8_t value;
+
+    map->width = width;
+    map->height = height;
+    map->pitch = ((width * bits) + 7) / 8;
+    map->data = calloc(map->pitch * height, 1);
+    if (!map->data)
+    {
+        printf("\tError: Can't allocate memory for the map. \n");
+        return false;
+    }
+
+    for (y = 0; y < height; ++y)
+    {
+        for (x = 0; x < width; ++x)
+        {
+            value = pixel_get(image, width, bitdepth, x, y);
+            if (value >= (1 << bits))
+            {
+                printf("\tSkiping file: Value %d at (%d, %d) doesn't fit in %d bits\n",
+                       value, x, y, bits);
+                free(map->data);
+                map->data = NULL;
+                return false;
+            }
+            /* First tile in the high bits */
+            bit = x * bits;
+            map->data[(y * map->pitch) + (bit / 8)] |= value << (8 - bits - (bit % 8));
+        }
+    }
+
+    printf("\tMap size in tiles: %dx%d\n", width, height);
+    printf("\tMap size in bytes: %d\n", map->pitch * height);
+
+    return true;
+}
+
+/**
+ * @brief Parses the input parameters
+ *
+ * @param argc Input arguments counter
+ * @param argv Input arguments vector
+ * @param params Where to store the input paramss
+ * @return 0 if there was an error
+ *         1 if the arguments parse was ok but we must end (-v or -h)
+ *         2 if the arguments parse was ok and we can continue
+ */
+uint8_t parse_params(uint32_t argc, char** argv, params_t *params)
+{
+    uint32_t i;
+
+    i = 1;
+    while (i < argc)
+    {
+        if ((strcmp(argv[i], "-v") == 0) || (strcmp(argv[i], "--version") == 0))
+        {
+            fputs(version_text, stdout);
+            return PARAMS_STOP;
+        }
+        else if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            fputs(help_text, stdout);
+            return PARAMS_STOP;
+        }
+        /* Source path where png files are */
+        else if (strcmp(argv[i], "-s") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->src_path = argv[i + 1];
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        /* Destination path to save the generated .h and .c files */
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->dest_path = argv[i + 1];
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        /* Base name for variables, defines, and  generated .h and .c files */
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->dest_name = argv[i + 1];
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        /* Bits per tile */
+        else if (strcmp(argv[i], "-b") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->bits = atoi(argv[i + 1]);
+                if (params->bits != 2 && params->bits != 4)
+                {
+                    fprintf(stderr, "%s: only 2 or 4 bits per tile supported: '%s'\n",
+                            argv[0], argv[i + 1]);
+                    return PARAMS_ERROR;
+                }
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "%s: unknown option: '%s'\n", argv[0], argv[i]);
+            return PARAMS_ERROR;
+        }
+        ++i;
+    }
+    return PARAMS_CONTINUE;
+}
+
+/**
+ * @brief Processes a png image file and builds its collision map
+ *
+ * @param path File path
+ * @param file Png image file to process
+ * @param bits Bits per tile in the collision map
+ * @param map_index Index in the maps array to store the data
+ * @return 0 if success, lodepng error code in other case
+ */
+uint32_t map_read(const char* path, const char *file, const uint8_t bits,
+                  const uint32_t map_index)
+{
+    char file_path[MAX_PATH_LENGTH];
+    char *file_ext;
+    uint32_t error;
+    uint8_t *png_data = NULL;
+    size_t png_size;
+    LodePNGState png_state;
+    uint8_t *image_data = NULL;
+    uint32_t image_width;
+    uint32_t image_height;
+    bool packed;
+
+    /* Builds the complete file path */
+    strcpy(file_path, path);
+    strcat(file_path, "/");
+    strcat(file_path, file);
+    printf("File %s\n", file_path);
+
+    /* Load the file into a memory buffer, no png checks here */
+    error = lodepng_load_file(&png_data, &png_size, file_path);
+    if (error)
+    {
+        free(png_data);
+        printf(lodepng_error_text(error));
+        return error;
+    }
+
+    lodepng_state_init(&png_state);
+    /* Get colors and pixels without conversion */
+    png_state.decoder.color_convert = false;
+    /* Decode our png image */
+    error = lodepng_decode(&image_data, &image_width, &image_height, &png_state,
+                           png_data, png_size);
+    free(png_data);
+    /* Checks for errors in the decode stage */
+    if (error)
+    {
+        printf("\tSkiping file: ");
+        printf(lodepng_error_text(error));
+        putchar('\n');
+        return error;
+    }
+
+    /* Checks if the image is an indexed one */
+    if (png_state.info_png.color.colortype != LCT_PALETTE)
+    {
+        printf("\tSkiping file: The image must be in indexed color mode\n");
+        free(image_data);
+        return 1;
+    }
+
+    /* Each pixel is a tile, pack them */
+    packed = collmap_pack(image_data, image_width, image_height,
+                          png_state.info_png.color.bitdepth, bits,
+                          &maps[map_index]);
+    free(image_data);
+    if (!packed)
+    {
+        return 1;
+    }
+
+    /* Save the map file name */
+    strcpy(maps[map_index].file, file);
+
+    /* Save the map name without the extension */
+    strcpy(maps[map_index].name, file);
+    file_ext = strrchr(maps[map_index].name, '.');
+    if (file_ext)
+    {
+        *file_ext = '\0';
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Builds the C header file for the generated collision maps
+ *
+ * @param path Destinatio path for the .h file
+ * @param name Base name for the .h file (name + .h)
+ * @param use_prefix Indicate if a prefix should be used for vars, etc.
+ * @param bits Bits per tile in the collision maps
+ * @param map_count Number of maps to process from the global map storage
+ * @return true if everythig was correct, false otherwise
+ */
+bool build_header_file(const char *path, const char *name,
+                       const bool use_prefix, const uint8_t bits,
+                       const uint32_t map_count)
+{
+    FILE *h_file;
+    char buff[MAX_PATH_LENGTH];
+    uint32_t i;
+
+    /* Builds the .h complete file path */
+    strcpy(buff, path);
+    strcat(buff, "/");
+    strcat(buff, name);
+    strcat(buff, ".h");
+
+    h_file = fopen(buff, "w");
+    if (!h_file)
+    {
+        return false;
+    }
+
+    /* An information message */
+    fprintf(h_file, "/* Generated with collmaptool v0.01                      */\n");
+    fprintf(h_file, "/* A Sega Megadrive/Genesis collision map builder        */\n");
+    fprintf(h_file, "/* Github: https://github.com/tapule/mddev               */\n\n");
+
+    /* Header include guard */
+    strcpy(buff, name);
+    strtoupper(buff);
+    strcat(buff, "_H");
+    fprintf(h_file, "#ifndef %s\n", buff);
+    fprintf(h_file, "#define %s\n\n", buff);
+    fprintf(h_file, "#include <stdint.h>\n\n");
+
+    /* Map sizes defines */
+    for (i = 0; i < map_count; ++i)
+    {
+        /* BASENAME_MAPNAME */
+        maps[i].define[0] = '\0';
+        if (use_prefix)
+        {
+            strcpy(maps[i].define, name);
+            strcat(maps[i].define, "_");
+        }
+        strcat(maps[i].define, maps[i].name);
+        strtoupper(maps[i].define);
+
+        fprintf(h_file, "#define %s_WIDTH    %d\n", maps[i].define,
+                maps[i].width);
+        fprintf(h_file, "#define %s_HEIGHT    %d\n", maps[i].define,
+                maps[i].height);
+        fprintf(h_file, "#define %s_BITS    %d\n", maps[i].define, bits);
+        fprintf(h_file, "#define %s_SIZE    %d\n", maps[i].define,
+                maps[i].pitch * maps[i].height);
+        fprintf(h_file, "\n");
+    }
+    fprintf(h_file, "\n");
+
+    /* Maps declarations */
+    for (i = 0; i < map_count; ++i)
+    {
+        buff[0] = '\0';
+        if (use_prefix)
+        {
+            strcpy(buff, name);
+            strcat(buff, "_");
+        }
+        strcat(buff, maps[i].name);
+        fprintf(h_file, "extern const uint8_t %s[%s_SIZE];\n", buff,
+                maps[i].define);
+    }
+    fprintf(h_file, "\n");
+
+    /* End of header include guard */
+    strcpy(buff, name);
+    strtoupper(buff);
+    strcat(buff, "_H");
+    fprintf(h_file, "#endif /* %s */\n", buff);
+
+    fclose(h_file);
+    return true;
+}
+
+/**
+ * @brief Builds the C source file for the generated collision maps
+ *
+ * @param path Destinatio path for the .c file
+ * @param name Base name for the .c file (name + .c)
+ * @param use_prefix Indicate if a prefix should be used for files, vars, etc.
+ * @param map_count Number of maps to process from the global map storage
+ * @return true if everythig was correct, false otherwise
+ */
+bool build_source_file(const char *path, const char *name,
+                       const bool use_prefix, const uint32_t map_count)
+{
+    FILE *c_file;
+    char buff[MAX_PATH_LENGTH];
+    uint32_t map;       /* Current map to process */
+    uint32_t row;       /* Current row */
+    uint32_t column;    /* Current byte in the row */
+    uint32_t size;      /* Map size in bytes */
+
+    /* Builds the .c complete file path */
+    strcpy(buff, path);
+    strcat(buff, "/");
+    strcat(buff, name);
+    strcat(buff, ".c");
+
+    c_file = fopen(buff, "w");
+    if (!c_file)
+    {
+        return false;
+    }
+
+    /* Header include */
+    strcpy(buff, name);
+    strcat(buff, ".h");
+    fprintf(c_file, "#include \"%s\"\n\n", buff);
+
+    for (map = 0; map < map_count; ++map)
+    {
+        buff[0] = '\0';
+        if (use_prefix)
+        {
+            strcpy(buff, name);
+            strcat(buff, "_");
+        }
+        strcat(buff, maps[map].name);
+        fprintf(c_file, "const uint8_t %s[%s_SIZE] = {", buff,
+                maps[map].define);
+
+        size = maps[map].pitch * maps[map].height;
+        for (row = 0; row < maps[map].height; ++row)
+        {
+            /* Separate map row definition from text line start */
+            fprintf(c_file, "\n    ");
+            /* Writes all the row bytes */
+            for (column = 0; column < maps[map].pitch; ++column)
+            {
+                fprintf(c_file, "0x%02X",
+                        maps[map].data[(row * maps[map].pitch) + column]);
+                /* If we aren't done, add a separator*/
+                if ((row * maps[map].pitch) + column + 1 < size)
+                {
+                    fprintf(c_file, ", ");
+                }
+            }
+        }
+        fprintf(c_file, "\n};\n\n");
+    }
+
+    fclose(c_file);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    params_t params = {0};
+    uint32_t map_index = 0;
+    DIR *dir;
+    char *file_name;
+    struct dirent *dir_entry;
+    uint8_t params_status;
+
+    /* Set default values here */
+    params.src_path = ".";
+    params.dest_path = ".";
+    params.bits = 2;
+
+    /* Argument reading and processing */
+    params_status = parse_params(argc, argv, &params);
+    if (params_status == PARAMS_ERROR)
+    {
+        return EXIT_FAILURE;
+    }
+    if (params_status == PARAMS_STOP)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    /* First try to open source path as a directory */
+    dir = opendir(params.src_path);
+    if (dir != NULL)
+    {
+        printf(version_text);
+        printf("\nReading files...\n");
+        while ((dir_entry = readdir(dir)) != NULL)
+        {
+            /* Checks max allowed maps */
+            if (map_index >= MAX_MAPS)
+            {
+                closedir(dir);
+                fprintf(stderr, "Error: More than %d files in the source directory\n", MAX_MAPS);
+                return EXIT_FAILURE;
+            }
+
+            /* Process only regular files */
+            if (dir_entry->d_type == DT_REG)
+            {
+                if (!map_read(params.src_path, dir_entry->d_name, params.bits,
+                              map_index))
+                {
+                    printf("\tPng file to collision map: %s -> %s\n",
+                           dir_entry->d_name, maps[map_index].name);
+                    ++map_index;
+                }
+            }
+        }
+        closedir(dir);
+    }
+    /* We can't open source path as directory, try to open it as file instead */
+    else
+    {
+        /* Get the file name and path */
+        file_name = strrchr(params.src_path, '/');
+        if (file_name)
+        {
+            *file_name = '\0';
+            ++file_name;
+        }
+        else
+        {
+            file_name = params.src_path;
+            params.src_path = ".";
+        }
+        printf(version_text);
+        printf("\nReading file...\n");
+        if (!map_read(params.src_path, file_name, params.bits, map_index))
+        {
+            printf("\tPng file to collision map: %s -> %s\n", file_name,
+                   maps[map_index].name);
+            ++map_index;
+        }
+    }
+
+    printf("%d maps readed.\n", map_index);
+
+    if (map_index > 0)
+    {
+        /* By default use BASE_NAME as prefix for files, defines, vars, etc */
+        bool use_prefix = true;
+
+        /* Adjust the destination base name if it was not specified */
+        if (!params.dest_name)
+        {
+            /* Only one file, use its name as base name and no prefix */
+            if (map_index == 1)
+            {
+                params.dest_name = maps[0].name;
+                use_prefix = false;
+            }
+            /* More than one file, use "coll" as base name */
+            else
+            {
+                params.dest_name = "coll";
+            }
+        }
+
+        printf("Building C header file...\n");
+        build_header_file(params.dest_path, params.dest_name, use_prefix,
+                          params.bits, map_index);
+        printf("Building C source file...\n");
+        build_source_file(params.dest_path, params.dest_name, use_prefix,
+                          map_index);
+        printf("Done.\n");
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,395 @@
+/* SPDX-License-Identifier: MIT */
+/**
+ * MDDev development kit
+ * Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021
+ * Github: https://github.com/tapule/mddev
+ *
+ * fixtabletool v0.02
+ *
+ * A fixed point math tables generator
+ *
+ * Builds the lookup tables used by the MDDev fixed point math module (fix.h)
+ * as C language data structures, so sine, cosine, arc tangent and divisions
+ * can be done in the m68k without slow divisions or floating point math.
+ *
+ * Usage example: fixtabletool -d dest/path -n fix_tables
+ *
+ * It generates the C source files "fix_tables.h" and "fix_tables.c" in
+ * "dest/path" directory with these tables:
+ *  - Sine table: A full turn of 1024 angle steps in signed 2.14 fixed point.
+ *  - Arc tangent table: 257 angles (in 1024 steps per turn) for the ratios
+ *    0/256..256/256, which covers the first octant.
+ *  - Reciprocal table: 2^32 / n rounded up for n in 0..255 as unsigned 0.32
+ *    fixed point. Entries 0 and 1 can't be represented and are set to 0.
+ *
+ * If -d parameter is not specified, the current directory will be used as
+ * destination folder.
+ * If -n parameter is not specified, "fix_tables" will be used as name.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+
+#define MAX_PATH_LENGTH         1024    /* Max length for paths */
+
+#define PARAMS_ERROR            0   /* Error en procesado de parámetros */
+#define PARAMS_STOP             1   /* Procesado de parámetros ok, finalizar */
+#define PARAMS_CONTINUE         2   /* Procesado de parámetros ok, procesar */
+
+/* Tables sizes */
+#define ANGLE_STEPS             1024    /* Angle steps in a full turn */
+#define ATAN_SIZE               257     /* Ratios 0/256..256/256 */
+#define RECIP_SIZE              256     /* Reciprocals of 0..255 */
+
+const char version_text [] =
+    "fixtabletool v0.02\n"
+    "A fixed point math tables generator\n"
+    "Coded by: Juan Ángel Moreno Fernández (@_tapule) 2021\n"
+    "Github: https://github.com/tapule/mddev\n";
+
+const char help_text [] =
+    "Usage: fixtabletool [options]\n"
+    "\n"
+    "Options:\n"
+    "  -v, --version       Show version information and exit\n"
+    "  -h, --help          Show this help message and exit\n"
+    "  -d <path>           Use a path to save generated C source files\n"
+    "                      The current directory will be used as default\n"
+    "  -n <name>           Use name as prefix for files, defines, vars, etc\n"
+    "                      If it is not specified, \"fix_tables\" will be used\n";
+
+/* Stores the input parameters */
+typedef struct params_t
+{
+    char *dest_path;        /* Destination folder for the generated .h and .c */
+    char *dest_name;        /* Base name prefix for the generated files */
+} params_t;
+
+/* Generated tables */
+int16_t sin_table[ANGLE_STEPS];
+uint16_t atan_table[ATAN_SIZE];
+uint32_t recip_table[RECIP_SIZE];
+
+/**
+ * @brief Convert a string to upper case
+ *
+ * @param str string to convert
+ */
+void strtoupper(char *str)
+{
+    char *c;
+    c = str;
+
+    while (*c)
+    {
+        *c = toupper(*c);
+        ++c;
+    }
+}
+
+/**
+ * @brief Parses the input parameters
+ *
+ * @param argc Input arguments counter
+ * @param argv Input arguments vector
+ * @param params Where to store the input paramss
+ * @return 0 if there was an error
+ *         1 if the arguments parse was ok but we must end (-v or -h)
+ *         2 if the arguments parse was ok and we can continue
+ */
+uint8_t parse_params(uint32_t argc, char** argv, params_t *params)
+{
+    uint32_t i;
+
+    i = 1;
+    while (i < argc)
+    {
+        if ((strcmp(argv[i], "-v") == 0) || (strcmp(argv[i], "--version") == 0))
+        {
+            fputs(version_text, stdout);
+            return PARAMS_STOP;
+        }
+        else if ((strcmp(argv[i], "-h") == 0) || (strcmp(argv[i], "--help") == 0))
+        {
+            fputs(help_text, stdout);
+            return PARAMS_STOP;
+        }
+        /* Destination path to save the generated .h and .c files */
+        else if (strcmp(argv[i], "-d") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->dest_path = argv[i + 1];
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        /* Base name for variables, defines, and  generated .h and .c files */
+        else if (strcmp(argv[i], "-n") == 0)
+        {
+            if (i < argc - 1)
+            {
+                params->dest_name = argv[i + 1];
+                ++i;
+            }
+            else
+            {
+                fprintf(stderr, "%s: an argument is needed for this option: '%s'\n",
+                        argv[0], argv[i]);
+                return PARAMS_ERROR;
+            }
+        }
+        else
+        {
+            fprintf(stderr, "%s: unknown option: '%s'\n", argv[0], argv[i]);
+            return PARAMS_ERROR;
+        }
+        ++i;
+    }
+    return PARAMS_CONTINUE;
+}
+
+/**
+ * @brief Calculates the values of all the tables
+ *
+ */
+void tables_build(void)
+{
+    uint32_t i;
+    double value;
+
+    /* Sine in 2.14 signed fixed point (1.0 = 16384) */
+    for (i = 0; i < ANGLE_STEPS; ++i)
+    {
+        value = sin((2.0 * M_PI * i) / ANGLE_STEPS);
+        sin_table[i] = (int16_t) lround(value * 16384.0);
+    }
+
+    /* Arc tangent of i/256 in angle steps (1/8 of a turn as maximum) */
+    for (i = 0; i < ATAN_SIZE; ++i)
+    {
+        value = atan((double) i / (ATAN_SIZE - 1));
+        atan_table[i] = (uint16_t) lround((value * ANGLE_STEPS) / (2.0 * M_PI));
+    }
+
+    /*
+     * Reciprocals in 0.32 unsigned fixed point, 0 and 1 don't fit. They are
+     * rounded up, so multiplying by them never gives a lower result
+     */
+    recip_table[0] = 0;
+    recip_table[1] = 0;
+    for (i = 2; i < RECIP_SIZE; ++i)
+    {
+        recip_table[i] = (uint32_t) (((1ULL << 32) + i - 1) / i);
+    }
+}
+
+/**
+ * @brief Writes a table definition in a C source file
+ *
+ * @param c_file Destination C source file
+ * @param data_type The data type name to use en the written data
+ * @param name Table name
+ * @param size_define Table size define name
+ * @param data Table values
+ * @param size Number of values in the table
+ */
+void table_write(FILE *c_file, const char *data_type, const char *name,
+                 const char *size_define, const int64_t *data,
+                 const uint32_t size)
+{
+    uint32_t i;
+
+    fprintf(c_file, "const %s %s[%s] = {", data_type, name, size_define);
+    for (i = 0; i < size; ++i)
+    {
+        /* Do we need to write a comma after the las value? */
+        if (i)
+        {
+            fprintf(c_file, ", ");
+        }
+        /* Every 8 written values, add a line feed */
+        if (i % 8 == 0)
+        {
+            fprintf(c_file, "\n    ");
+        }
+        fprintf(c_file, "%6lld", (long long) data[i]);
+    }
+    fprintf(c_file, "\n};\n\n");
+}
+
+/**
+ * @brief Builds the C header file for the generated tables
+ *
+ * @param path Destination path for the .h file
+ * @param name Base name for the .h file (name + .h)
+ * @return true if everythig was correct, false otherwise
+ */
+bool build_header_file(const char *path, const char *name)
+{
+    FILE *h_file;
+    char buff[MAX_PATH_LENGTH];
+    char prefix[MAX_PATH_LENGTH];
+
+    /* Builds the .h complete file path */
+    strcpy(buff, path);
+    strcat(buff, "/");
+    strcat(buff, name);
+    strcat(buff, ".h");
+
+    h_file = fopen(buff, "w");
+    if (!h_file)
+    {
+        printf("\tError building C header: file %s can't be created\n", buff);
+        return false;
+    }
+
+    /* An information message */
+    fprintf(h_file, "/* Generated with fixtabletool v0.02                     */\n");
+    fprintf(h_file, "/* A fixed point math tables generator                   */\n");
+    fprintf(h_file, "/* Github: https://github.com/tapule/mddev               */\n\n");
+
+    /* Header include guard */
+    strcpy(prefix, name);
+    strtoupper(prefix);
+    fprintf(h_file, "#ifndef %s_H\n", prefix);
+    fprintf(h_file, "#define %s_H\n\n", prefix);
+    fprintf(h_file, "#include <stdint.h>\n\n");
+
+    /* Tables size defines */
+    fprintf(h_file, "#define %s_SIN_SIZE    %d\n", prefix, ANGLE_STEPS);
+    fprintf(h_file, "#define %s_ATAN_SIZE    %d\n", prefix, ATAN_SIZE);
+    fprintf(h_file, "#define %s_RECIP_SIZE    %d\n\n", prefix, RECIP_SIZE);
+
+    /* Tables declarations */
+    fprintf(h_file, "extern const int16_t %s_sin[%s_SIN_SIZE];\n", name, prefix);
+    fprintf(h_file, "extern const uint16_t %s_atan[%s_ATAN_SIZE];\n", name,
+            prefix);
+    fprintf(h_file, "extern const uint32_t %s_recip[%s_RECIP_SIZE];\n\n", name,
+            prefix);
+
+    /* End of header include guard */
+    fprintf(h_file, "#endif /* %s_H */\n", prefix);
+
+    fclose(h_file);
+
+    return true;
+}
+
+/**
+ * @brief Builds the C source file for the generated tables
+ *
+ * @param path Destinatio path for the .c file
+ * @param name Base name for the .c file (name + .c)
+ * @return true if everythig was correct, false otherwise
+ */
+bool build_source_file(const char *path, const char *name)
+{
+    FILE *c_file;
+    char buff[MAX_PATH_LENGTH];
+    char prefix[MAX_PATH_LENGTH];
+    int64_t values[ANGLE_STEPS];
+    uint32_t i;
+
+    /* Builds the .c complete file path */
+    strcpy(buff, path);
+    strcat(buff, "/");
+    strcat(buff, name);
+    strcat(buff, ".c");
+
+    c_file = fopen(buff, "w");
+    if (!c_file)
+    {
+        printf("\tError building C source: file %s can't be created\n", buff);
+        return false;
+    }
+
+    /* Header include */
+    fprintf(c_file, "#include \"%s.h\"\n\n", name);
+
+    strcpy(prefix, name);
+    strtoupper(prefix);
+
+    /* Sine table */
+    for (i = 0; i < ANGLE_STEPS; ++i)
+    {
+        values[i] = sin_table[i];
+    }
+    sprintf(buff, "%s_sin", name);
+    strcat(prefix, "_SIN_SIZE");
+    table_write(c_file, "int16_t", buff, prefix, values, ANGLE_STEPS);
+
+    /* Arc tangent table */
+    for (i = 0; i < ATAN_SIZE; ++i)
+    {
+        values[i] = atan_table[i];
+    }
+    sprintf(buff, "%s_atan", name);
+    strcpy(prefix, name);
+    strtoupper(prefix);
+    strcat(prefix, "_ATAN_SIZE");
+    table_write(c_file, "uint16_t", buff, prefix, values, ATAN_SIZE);
+
+    /* Reciprocal table */
+    for (i = 0; i < RECIP_SIZE; ++i)
+    {
+        values[i] = recip_table[i];
+    }
+    sprintf(buff, "%s_recip", name);
+    strcpy(prefix, name);
+    strtoupper(prefix);
+    strcat(prefix, "_RECIP_SIZE");
+    table_write(c_file, "uint32_t", buff, prefix, values, RECIP_SIZE);
+
+    fclose(c_file);
+
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    params_t params = {0};
+    uint8_t params_status;
+
+    /* Set default values here */
+    params.dest_path = ".";
+    params.dest_name = "fix_tables";
+
+    /* Argument reading and processing */
+    params_status = parse_params(argc, argv, &params);
+    if (params_status == PARAMS_ERROR)
+    {
+        return EXIT_FAILURE;
+    }
+    if (params_status == PARAMS_STOP)
+    {
+        return EXIT_SUCCESS;
+    }
+
+    printf(version_text);
+    printf("\nBuilding tables...\n");
+    tables_build();
+
+    printf("Building C header file...\n");
+    if (!build_header_file(params.dest_path, params.dest_name))
+    {
+        return EXIT_FAILURE;
+    }
+    printf("Building C source file...\n");
+    if (!build_source_file(params.dest_path, params.dest_name))
+    {
+        return EXIT_FAILURE;
+    }
+    printf("Done.\n");
+
+    return EXIT_SUCCESS;
+}
@@ -17,6 +17,9 @@ int XGC_computeLenInSecond(XGM* source);
 int XGC_getTime(XGM* source, XGMCommand* command);
 int XGC_getTimeInFrame(XGM* xgm, XGMCommand* command);
 int XGC_getCommandIndexAtTime(XGM* source, int time);
+void XGC_optimizeSampleLayout(XGM* source);
+void XGC_printBankSwitches(XGM* source);
+
 unsigned char* XGC_asByteArray(XGM* source, int *outSize);
 
 
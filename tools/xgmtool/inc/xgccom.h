@@ -6,6 +6,10 @@
 #define XGC_PSG_ENV     0x18
 #define XGC_PCM         0x50
 #define XGC_STATE       0x60
+#define XGC_YM_LEVEL    0x70
+
+// maximum number of TL writes in a YM level command (0x7C-0x7F are reserved)
+#define XGC_YM_LEVEL_MAX    12
 
 #define XGC_FRAME_SKIP  0x7D
 
@@ -27,11 +31,14 @@ bool XGCCommand_isPSGToneWrite(XGMCommand* source);
 bool XGCCommand_isPCM(XGMCommand* source);
 int XGCCommand_getPCMId(XGMCommand* source);
 bool XGCCommand_isState(XGMCommand* source);
+bool XGCCommand_isYMLevel(XGMCommand* source);
 
 LList* XGCCommand_createPSGEnvCommands(LList* commands);
 LList* XGCCommand_createPSGToneCommands(LList* commands);
 LList* XGCCommand_createYMKeyCommands(LList* commands);
 LList* XGCCommand_createStateCommands(LList* commands);
+LList* XGCCommand_createYMLevelCommands(LList* levels);
+LList* XGCCommand_convertYMLevel(XGMCommand* command);
 
 LList* XGCCommand_convertSingle(XGMCommand* command);
 LList* XGCCommand_convert(LList* commands);
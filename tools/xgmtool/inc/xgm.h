@@ -8,6 +8,8 @@
 typedef struct
 {
     LList* samples;
+    // sample data order in XGC (NULL = same as samples)
+    LList* sampleLayout;
     LList* commands;
     GD3* gd3;
     XD3* xd3;
@@ -10,6 +10,8 @@ extern bool verbose;
 extern bool sampleIgnore;
 extern bool sampleRateFix;
 extern bool delayKeyOff;
+extern bool sampleLayout;
+extern bool bankReport;
 
 
 #endif // XGMTOOL_H_
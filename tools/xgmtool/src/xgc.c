@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <memory.h>
 
 #include "../inc/xgm.h"
@@ -15,6 +16,16 @@
 // forward
 static void XGC_extractMusic(XGM* xgc, XGM* xgm);
 static int XGC_computeLenInFrameOf(LList* commands);
+static int* XGC_getSampleOffsets(XGM* source);
+
+// Z80 bank window size
+#define XGC_BANK_SIZE       0x8000
+// PCM output rate of the XGM driver
+#define XGC_PCM_RATE        14000
+// PCM samples read per channel each time the driver fills its buffer
+#define XGC_PCM_BLOCK       256
+// bank of the null sample (outside the XGC data)
+#define XGC_NULL_BANK       -1
 
 XGM* XGC_create(XGM* xgm)
 {
@@ -94,10 +105,42 @@ XGM* XGC_create(XGM* xgm)
     return result;
 }
 
+/**
+ * Carrier operators mask (bit = TL register slot, (reg >> 2) & 3) of the channel addressed by reg,
+ * or -1 if reg doesn't address a channel algorithm
+ */
+static int XGC_getYMCarriers(YM2612* ymState, int port, int reg)
+{
+    // carriers for each algorithm (slot order is operator 1, 3, 2, 4)
+    static const int carriers[8] = { 0x8, 0x8, 0x8, 0x8, 0xC, 0xE, 0xE, 0xF };
+
+    if ((reg < 0xB0) || (reg >= 0xB3))
+        return -1;
+
+    return carriers[YM2612_get(ymState, port, reg) & 7];
+}
+
+/**
+ * Add the (slot, value) level pair for the TL register write to the level list.
+ * Modulators are flagged (bit 7) so the driver writes them without attenuation.
+ */
+static LList* XGC_addYMLevel(LList* levels, YM2612* ymState, int port, int reg)
+{
+    const int carriers = XGC_getYMCarriers(ymState, port, 0xB0 + (reg & 3));
+    int value = YM2612_get(ymState, port, reg) & 0x7F;
+
+    if (!(carriers & (1 << ((reg >> 2) & 3))))
+        value |= 0x80;
+
+    levels = insertAfterLList(levels, (void*) (intptr_t) (0xC0 + (port << 4) + (reg & 0xF)));
+    return insertAfterLList(levels, (void*) (intptr_t) value);
+}
+
 static void XGC_extractMusic(XGM* xgc, XGM* xgm)
 {
     LList* frameCommands = NULL;
     LList* ymOtherCommands = NULL;
+    LList* ymLevels = NULL;
     LList* ymKeyCommands = NULL;
     LList* ymCommands = NULL;
     LList* psgCommands = NULL;
@@ -112,9 +155,10 @@ static void XGC_extractMusic(XGM* xgc, XGM* xgm)
     YM2612* ymLoopState;
     YM2612* ymOldState;
     YM2612* ymState;
-    int j, size;
+    int j, op, reg, size;
     int time;
     bool hasKeyCom;
+    bool keep;
 
     time = 0;
     ymLoopState = NULL;
@@ -187,11 +231,13 @@ static void XGC_extractMusic(XGM* xgc, XGM* xgm)
 
         // group commands
         deleteLList(ymOtherCommands);
+        deleteLList(ymLevels);
         deleteLList(ymKeyCommands);
         deleteLList(ymCommands);
         deleteLList(psgCommands);
         deleteLList(otherCommands);
         ymOtherCommands = NULL;
+        ymLevels = NULL;
         ymKeyCommands = NULL;
         ymCommands = NULL;
         psgCommands = NULL;
@@ -219,16 +265,23 @@ static void XGC_extractMusic(XGM* xgc, XGM* xgm)
                     ymOtherCommands = getHeadLList(ymOtherCommands);
                     ymKeyCommands = getHeadLList(ymKeyCommands);
 
+                    ymLevels = getHeadLList(ymLevels);
+
                     // general YM commands first as key event were just done
                     if (ymOtherCommands != NULL)
                         ymCommands = insertAllAfterLList(ymCommands, XGCCommand_convert(ymOtherCommands));
+                    // then TL writes
+                    if (ymLevels != NULL)
+                        ymCommands = insertAllAfterLList(ymCommands, XGCCommand_createYMLevelCommands(ymLevels));
                     // then key commands
                     if (ymKeyCommands != NULL)
                         ymCommands = insertAllAfterLList(ymCommands, XGCCommand_convert(ymKeyCommands));
 
                     deleteLList(ymOtherCommands);
+                    deleteLList(ymLevels);
                     deleteLList(ymKeyCommands);
                     ymOtherCommands = NULL;
+                    ymLevels = NULL;
                     ymKeyCommands = NULL;
 
                     hasKeyCom = false;
@@ -237,14 +290,33 @@ static void XGC_extractMusic(XGM* xgc, XGM* xgm)
                 // update YM state
                 for (j = 0; j < XGMCommand_getYM2612WriteCount(command); j++)
                 {
-                    if (XGMCommand_isYM2612Port0Write(command))
-                        YM2612_set(ymState, 0, command->data[(j * 2) + 1] & 0xFF, command->data[(j * 2) + 2] & 0xFF);
-                    else
-                        YM2612_set(ymState, 1, command->data[(j * 2) + 1] & 0xFF, command->data[(j * 2) + 2] & 0xFF);
+                    const int port = XGMCommand_isYM2612Port0Write(command) ? 0 : 1;
+                    const int reg = command->data[(j * 2) + 1] & 0xFF;
+                    // carriers before the write (an algorithm change moves the attenuated operators)
+                    const int carriers = XGC_getYMCarriers(ymState, port, reg);
+
+                    YM2612_set(ymState, port, reg, command->data[(j * 2) + 2] & 0xFF);
+
+                    // TL write --> level command
+                    if ((reg >= 0x40) && (reg < 0x50) && ((reg & 3) != 3))
+                        ymLevels = XGC_addYMLevel(ymLevels, ymState, port, reg);
+                    // algorithm change --> refresh the channel TL
+                    else if ((reg >= 0xB0) && (reg < 0xB3) && (carriers != XGC_getYMCarriers(ymState, port, reg)))
+                    {
+                        for (op = 0; op < 4; op++)
+                            if (ymState->init[port][0x40 + (op << 2) + (reg & 3)])
+                                ymLevels = XGC_addYMLevel(ymLevels, ymState, port, 0x40 + (op << 2) + (reg & 3));
+                    }
                 }
 
                 // remove all $2B register writes (DAC enable is done automatically)
-                if (XGMCommand_removeYM2612RegWrite(command, 0, 0x2B))
+                keep = XGMCommand_removeYM2612RegWrite(command, 0, 0x2B);
+                // remove TL register writes (done through level commands so the driver can attenuate them)
+                for (reg = 0x40; keep && (reg < 0x50); reg++)
+                    if ((reg & 3) != 3)
+                        keep = XGMCommand_removeYM2612RegWrite(command, -1, reg);
+
+                if (keep)
                     ymOtherCommands = insertAfterLList(ymOtherCommands, command);
             }
             else
@@ -298,11 +370,15 @@ static void XGC_extractMusic(XGM* xgc, XGM* xgm)
 
         // merge YM commands
         ymOtherCommands = getHeadLList(ymOtherCommands);
+        ymLevels = getHeadLList(ymLevels);
         ymKeyCommands = getHeadLList(ymKeyCommands);
 
         // general YM commands first as key event were just done
         if (ymOtherCommands != NULL)
             ymCommands = insertAllAfterLList(ymCommands, XGCCommand_convert(ymOtherCommands));
+        // then TL writes
+        if (ymLevels != NULL)
+            ymCommands = insertAllAfterLList(ymCommands, XGCCommand_createYMLevelCommands(ymLevels));
         // then key commands
         if (ymKeyCommands != NULL)
             ymCommands = insertAllAfterLList(ymCommands, XGCCommand_convert(ymKeyCommands));
@@ -705,6 +781,266 @@ LList* XGC_getCommandElementAtTime(XGM* source, int time)
     return com;
 }
 
+/**
+ * Return sample data offsets (in the XGC sample block) in sample list order
+ */
+static int* XGC_getSampleOffsets(XGM* source)
+{
+    const int num = getSizeLList(source->samples);
+    int* result = calloc(num + 1, sizeof(int));
+    void** samples = llistToArray(source->samples);
+    LList* l;
+    int offset;
+    int i;
+
+    offset = 0;
+    l = source->sampleLayout ? source->sampleLayout : source->samples;
+    while(l != NULL)
+    {
+        XGMSample* sample = l->element;
+
+        for (i = 0; i < num; i++)
+            if (samples[i] == sample)
+                result[i] = offset;
+
+        offset += sample->dataSize;
+        l = l->next;
+    }
+
+    free(samples);
+
+    return result;
+}
+
+/**
+ * Order sample data to minimize Z80 bank switches.
+ * Samples are packed backward from the end of the sample block, where the music
+ * data starts: each 32 KB bank gets the most played samples which fit in it, so
+ * the most played ones share the bank of the music data and samples don't cross
+ * a bank boundary when they can avoid it. Only samples which fit nowhere are
+ * allowed to cross one, the least played first.
+ * Sample ids (table order) don't change.
+ */
+void XGC_optimizeSampleLayout(XGM* source)
+{
+    const int num = getSizeLList(source->samples);
+    void** samples = llistToArray(source->samples);
+    int* weights = calloc(num + 1, sizeof(int));
+    int* order = calloc(num + 1, sizeof(int));
+    bool* placed = calloc(num + 1, sizeof(bool));
+    LList* layout;
+    LList* com;
+    int end;
+    int i, n;
+
+    // weight = amount of sample data read by all the plays
+    com = source->commands;
+    while(com != NULL)
+    {
+        XGMCommand* command = com->element;
+
+        if (XGMCommand_isPCM(command))
+        {
+            const int id = XGMCommand_getPCMId(command);
+
+            if ((id > 0) && (id <= num))
+                weights[id - 1] += ((XGMSample*) samples[id - 1])->dataSize;
+        }
+
+        com = com->next;
+    }
+
+    // fill the banks backward, order[] gets the samples from the last one
+    end = 0x100 + XGM_getSampleDataSize(source);
+    for (n = 0; n < num; n++)
+    {
+        // room left in the bank before the current end
+        const int room = end - (((end - 1) / XGC_BANK_SIZE) * XGC_BANK_SIZE);
+        int best = -1;
+
+        // most played sample which fits in the room
+        for (i = 0; i < num; i++)
+        {
+            const int size = ((XGMSample*) samples[i])->dataSize;
+
+            if (placed[i] || (size > room))
+                continue;
+            if ((best == -1) || (weights[i] > weights[best]))
+                best = i;
+        }
+        // none fits: the least played one crosses the bank boundary
+        if (best == -1)
+        {
+            for (i = 0; i < num; i++)
+            {
+                if (placed[i])
+                    continue;
+                if ((best == -1) || (weights[i] < weights[best]))
+                    best = i;
+            }
+        }
+
+        placed[best] = true;
+        order[n] = best;
+        end -= ((XGMSample*) samples[best])->dataSize;
+    }
+
+    layout = NULL;
+    for (i = 0; i < num; i++)
+    {
+        const int s = order[num - (i + 1)];
+
+        layout = insertAfterLList(layout, samples[s]);
+
+        if (verbose)
+            printf("Sample #%d placed at position %d (%d bytes played)\n", s + 1, i, weights[s]);
+    }
+    source->sampleLayout = getHeadLList(layout);
+
+    free(samples);
+    free(weights);
+    free(order);
+    free(placed);
+}
+
+/**
+ * Estimate the Z80 bank switches needed to play the XGC (first pass, without loop).
+ * Each time the driver fills its PCM buffer it reads the music data and a
+ * block of each PCM channel (null sample for silent ones), setting the bank
+ * for each read. The sample blocks really read by the track are counted, and
+ * the reads which land in a different bank than the previous one, which
+ * depend on the sample layout.
+ * The XGC data is supposed to start on a 32 KB boundary.
+ */
+void XGC_printBankSwitches(XGM* source)
+{
+    const int num = getSizeLList(source->samples);
+    const int fps = source->pal ? 50 : 60;
+    const int musicAddr = 0x100 + XGM_getSampleDataSize(source) + 4;
+    void** samples = llistToArray(source->samples);
+    int* offsets = XGC_getSampleOffsets(source);
+    int chAddr[4];
+    int chLeft[4];
+    int musicOffset;
+    int lastBank;
+    int frame;
+    int round;
+    int second;
+    int switches;
+    int total;
+    int peak;
+    int reads;
+    int readTotal;
+    int readPeak;
+    int ch;
+    LList* com;
+
+    for (ch = 0; ch < 4; ch++)
+        chLeft[ch] = 0;
+
+    musicOffset = 0;
+    lastBank = XGC_NULL_BANK;
+    frame = 0;
+    round = 0;
+    second = 0;
+    switches = 0;
+    total = 0;
+    peak = 0;
+    reads = 0;
+    readTotal = 0;
+    readPeak = 0;
+
+    com = source->commands;
+    while(com != NULL)
+    {
+        XGMCommand* command = com->element;
+
+        if (XGCCommand_isFrameSize(command))
+        {
+            // buffer fills done before this frame
+            while (((long) round * XGC_PCM_BLOCK * fps) / XGC_PCM_RATE < frame)
+            {
+                int banks[5];
+                int i;
+
+                banks[0] = (musicAddr + musicOffset) / XGC_BANK_SIZE;
+                for (ch = 0; ch < 4; ch++)
+                {
+                    if (chLeft[ch] > 0)
+                    {
+                        banks[ch + 1] = chAddr[ch] / XGC_BANK_SIZE;
+                        chAddr[ch] += XGC_PCM_BLOCK;
+                        chLeft[ch] -= XGC_PCM_BLOCK;
+                        reads++;
+                    }
+                    else
+                        banks[ch + 1] = XGC_NULL_BANK;
+                }
+
+                for (i = 0; i < 5; i++)
+                {
+                    if (banks[i] != lastBank)
+                    {
+                        switches++;
+                        lastBank = banks[i];
+                    }
+                }
+
+                round++;
+
+                // one second elapsed ?
+                if ((round * XGC_PCM_BLOCK) / XGC_PCM_RATE != second)
+                {
+                    if (switches > peak)
+                        peak = switches;
+                    if (reads > readPeak)
+                        readPeak = reads;
+                    total += switches;
+                    readTotal += reads;
+                    switches = 0;
+                    reads = 0;
+                    second++;
+                }
+            }
+
+            frame++;
+        }
+        else if (XGMCommand_isPCM(command))
+        {
+            const int id = XGMCommand_getPCMId(command);
+
+            ch = XGMCommand_getPCMChannel(command);
+            if ((id > 0) && (id <= num))
+            {
+                chAddr[ch] = 0x100 + offsets[id - 1];
+                chLeft[ch] = ((XGMSample*) samples[id - 1])->dataSize;
+            }
+            else
+                chLeft[ch] = 0;
+        }
+
+        musicOffset = command->offset;
+        com = com->next;
+    }
+    total += switches;
+    readTotal += reads;
+
+    printf("Bank switches (XGC aligned on 32 KB):\n");
+    if (second > 0)
+    {
+        printf("  sample block reads: %d per second average, %d peak\n", readTotal / second, readPeak);
+        printf("  reads in a new bank: %d per second average, %d peak\n", total / second, peak);
+    }
+    else
+    {
+        printf("  sample block reads: %d in %d frames\n", readTotal, frame);
+        printf("  reads in a new bank: %d in %d frames\n", total, frame);
+    }
+
+    free(samples);
+    free(offsets);
+}
+
 unsigned char* XGC_asByteArray(XGM* source, int *outSize)
 {
     int s;
@@ -719,6 +1055,8 @@ unsigned char* XGC_asByteArray(XGM* source, int *outSize)
         return NULL;
     }
 
+    int* offsets = XGC_getSampleOffsets(source);
+
     // 0000-00FB: sample id table
     // fixed size : 252 bytes, limit music to 63 samples max
     offset = 0;
@@ -729,6 +1067,9 @@ unsigned char* XGC_asByteArray(XGM* source, int *outSize)
         XGMSample* sample = l->element;
         int len = sample->dataSize;
 
+        // data can be in a different order than the table (see XGC_optimizeSampleLayout)
+        offset = offsets[s];
+
         byte = offset >> 8;
         fwrite(&byte, 1, 1, f);
         byte = offset >> 16;
@@ -738,10 +1079,11 @@ unsigned char* XGC_asByteArray(XGM* source, int *outSize)
         byte = len >> 16;
         fwrite(&byte, 1, 1, f);
 
-        offset += len;
         s++;
         l = l->next;
     }
+    free(offsets);
+    offset = XGM_getSampleDataSize(source);
     for (; s < 0x3F; s++)
     {
         // special mark for silent sample
@@ -774,7 +1116,7 @@ unsigned char* XGC_asByteArray(XGM* source, int *outSize)
     fwrite(&byte, 1, 1, f);
 
     // 0100-XXXX: sample data
-    l = source->samples;
+    l = source->sampleLayout ? source->sampleLayout : source->samples;
     while(l != NULL)
     {
         XGMSample* sample = l->element;
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <memory.h>
 #include <math.h>
 
@@ -89,6 +90,10 @@ XGMCommand* XGCCommand_createFromData(unsigned char* data)
         case XGM_PCM:
             result->size = 2;
             break;
+
+        case XGC_YM_LEVEL:
+            result->size = 1 + (2 * ((command & 0xF) + 1));
+            break;
     }
 
     data[0] = command;
@@ -157,6 +162,11 @@ bool XGCCommand_isState(XGMCommand* source)
     return (source->command & 0xF0) == XGC_STATE;
 }
 
+bool XGCCommand_isYMLevel(XGMCommand* source)
+{
+    return (source->command >= XGC_YM_LEVEL) && (source->command < (XGC_YM_LEVEL + XGC_YM_LEVEL_MAX));
+}
+
 
 static XGMCommand* XGCCommand_createPSGEnvCommand(LList** pcommands)
 {
@@ -294,6 +304,80 @@ LList* XGCCommand_createStateCommands(LList* commands)
     return getHeadLList(result);
 }
 
+/**
+ * Level entries are (slot, value) pairs where slot = $C0 + (port * 16) + (reg & $0F) and
+ * value = TL, bit 7 set when the operator is not a carrier (the driver doesn't attenuate it)
+ */
+static XGMCommand* XGCCommand_createYMLevelCommand(LList** plevels)
+{
+    LList* curLevel = *plevels;
+    const int size = min(XGC_YM_LEVEL_MAX, (getSizeLList(curLevel) / 2));
+    unsigned char* data = malloc((size * 2) + 1);
+    int i, off;
+
+    data[0] = XGC_YM_LEVEL | (size - 1);
+
+    off = 1;
+    for (i = 0; i < size; i++)
+    {
+        data[off++] = (int) (intptr_t) curLevel->element;
+        curLevel = curLevel->next;
+        data[off++] = (int) (intptr_t) curLevel->element;
+        curLevel = curLevel->next;
+    }
+
+    // update list pointer to remove elements we have done
+    *plevels = curLevel;
+
+    return XGMCommand_create(data, (size * 2) + 1);
+}
+
+LList* XGCCommand_createYMLevelCommands(LList* levels)
+{
+    LList* result;
+    LList* src;
+
+    result = NULL;
+    src = levels;
+
+    while (src != NULL)
+        result = insertAfterLList(result, XGCCommand_createYMLevelCommand(&src));
+
+    return getHeadLList(result);
+}
+
+LList* XGCCommand_convertYMLevel(XGMCommand* command)
+{
+    LList* port0 = NULL;
+    LList* port1 = NULL;
+    LList* result = NULL;
+    const int size = (command->data[0] & 0xF) + 1;
+    int i;
+
+    // back to plain TL register writes
+    for (i = 0; i < size; i++)
+    {
+        const int slot = command->data[(i * 2) + 1] & 0xFF;
+        const int value = command->data[(i * 2) + 2] & 0x7F;
+        VGMCommand* vgmCommand = VGMCommand_createYMCommand((slot >> 4) & 1, 0x40 | (slot & 0xF), value);
+
+        if (slot & 0x10)
+            port1 = insertAfterLList(port1, vgmCommand);
+        else
+            port0 = insertAfterLList(port0, vgmCommand);
+    }
+
+    if (port0 != NULL)
+        result = insertAllAfterLList(result, XGMCommand_createYMPort0Commands(getHeadLList(port0)));
+    if (port1 != NULL)
+        result = insertAllAfterLList(result, XGMCommand_createYMPort1Commands(getHeadLList(port1)));
+
+    deleteLList(port0);
+    deleteLList(port1);
+
+    return getHeadLList(result);
+}
+
 LList* XGCCommand_convertSingle(XGMCommand* command)
 {
     int i, size;
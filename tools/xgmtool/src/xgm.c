@@ -23,6 +23,7 @@ XGM* XGM_create()
     result = malloc(sizeof(XGM));
 
     result->samples = NULL;
+    result->sampleLayout = NULL;
     result->commands = NULL;
     result->gd3 = NULL;
     result->xd3 = NULL;
@@ -239,8 +240,11 @@ static void XGM_parseMusicFromXGC(XGM* xgm, unsigned char* data, int length)
         {
             XGMCommand* command = XGCCommand_createFromData(data + off);
 
+            // level command --> back to TL register writes
+            if (XGCCommand_isYMLevel(command))
+                commands = insertAllAfterLList(commands, XGCCommand_convertYMLevel(command));
             // add command if not state or frame skip command
-            if (!XGCCommand_isState(command) && !XGCCommand_isFrameSkip(command))
+            else if (!XGCCommand_isState(command) && !XGCCommand_isFrameSkip(command))
                 commands = insertAfterLList(commands, command);
 
             off += command->size;
@@ -14,13 +14,15 @@
 #define SYSTEM_PAL      1
 
 
-const char* version = "1.73";
+const char* version = "1.74";
 int sys;
 bool silent;
 bool verbose;
 bool sampleRateFix;
 bool sampleIgnore;
 bool delayKeyOff;
+bool sampleLayout;
+bool bankReport;
 
 
 int main(int argc, char *argv[ ])
@@ -74,6 +76,8 @@ int main(int argc, char *argv[ ])
         printf("-di\tdisable PCM sample auto ignore (it can help when PCM are not properly extracted).\n");
         printf("-dr\tdisable PCM sample rate auto fix (it can help when PCM are not properly extracted).\n");
         printf("-dd\tdisable delayed KEY OFF event when we have KEY ON/OFF in a single frame (it can fix incorrect instrument sound).\n");
+        printf("-l\torder XGC sample data to minimize Z80 bank switches (packed in banks, most played samples next to music data).\n");
+        printf("-b\treport the Z80 bank switches per second needed to play the XGC.\n");
 
         exit(1);
     }
@@ -84,6 +88,8 @@ int main(int argc, char *argv[ ])
     sampleIgnore = true;
     sampleRateFix = true;
     delayKeyOff = true;
+    sampleLayout = false;
+    bankReport = false;
 
     // Open source for binary read (will fail if file does not exist)
     if ((infile = fopen(argv[1], "rb")) == NULL)
@@ -124,6 +130,10 @@ int main(int argc, char *argv[ ])
             sys = SYSTEM_NTSC;
         else if (!strcasecmp(argv[i], "-p"))
             sys = SYSTEM_PAL;
+        else if (!strcasecmp(argv[i], "-l"))
+            sampleLayout = true;
+        else if (!strcasecmp(argv[i], "-b"))
+            bankReport = true;
         else
             printf("Warning: option %s not recognized (ignored)\n", argv[i]);
     }
@@ -199,6 +209,11 @@ int main(int argc, char *argv[ ])
                     // convert to XGC (compiled XGM)
                     xgc = XGC_create(xgm);
                     if (xgc == NULL) exit(1);
+                    // sample data layout and bank switches report
+                    if (sampleLayout)
+                        XGC_optimizeSampleLayout(xgc);
+                    if (bankReport)
+                        XGC_printBankSwitches(xgc);
                     // get byte array
                     outData = XGC_asByteArray(xgc, &outDataSize);
                 }
@@ -250,6 +265,11 @@ int main(int argc, char *argv[ ])
                 // convert to XGC (compiled XGM)
                 xgc = XGC_create(xgm);
                 if (xgc == NULL) exit(1);
+                // sample data layout and bank switches report
+                if (sampleLayout)
+                    XGC_optimizeSampleLayout(xgc);
+                if (bankReport)
+                    XGC_printBankSwitches(xgc);
                 // get byte array
                 outData = XGC_asByteArray(xgc, &outDataSize);
             }